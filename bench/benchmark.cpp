@@ -0,0 +1,447 @@
+#include "../src/include/TraceReplay.h"
+#include "../src/include/WorkloadGenerator.h"
+#include "../src/include/FrameStore.h"
+#include "../src/include/ConcurrentClock.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+
+#ifdef _WIN32
+// Sem as macros min/max do windows.h, que quebram std::min/std::max
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/**
+ * @brief Benchmark de desempenho das politicas de substituicao
+ *
+ * Mede referencias/segundo, ns/referencia e pico de memoria residente de
+ * todas as politicas do replay para varios numeros de frames e formatos
+ * de trace. A saida e um JSON estavel (uma medicao por linha),
+ * para comparar versoes com um diff simples.
+ *
+ * Suites:
+ *   micro  - laco sobre metade dos frames: apos o aquecimento so ha hits,
+ *            isolando o custo da busca
+ *   macro  - replay completo com os formatos loop, scan, zipf e random
+ *   memory - varredura que enche e substitui todos os frames uma vez, no
+ *            maior numero de frames; bytes_per_frame = crescimento do pico
+ *            de memoria residente / frames (confiavel no Linux, onde o pico
+ *            pode ser zerado antes de cada medicao)
+ *   concurrent - ConcurrentClock com 1, 2, 4, ... threads (ate o numero de
+ *            cores), cada uma repetindo o mesmo trace sobre o pool
+ *            compartilhado; no formato hit a vazao deve crescer com as
+ *            threads
+ */
+
+static const char* SCHEMA = "pagesim-bench/3";
+static const uint64_t SEED = 20250101;
+
+/**
+ * @brief Parametros da execucao
+ */
+struct BenchConfig {
+    size_t references;        // Referencias minimas por trace
+    int maxFrames;            // Maior numero de frames medido
+    int repeat;               // Repeticoes por medicao (vale a mais rapida)
+    std::string outputFile;   // Vazio = saida padrao
+    
+    BenchConfig() : references(1000000), maxFrames(4 * 1024 * 1024), repeat(1) {}
+};
+
+/**
+ * @brief Uma medicao (suite, algoritmo, formato, frames)
+ */
+struct BenchResult {
+    std::string suite;
+    std::string algorithm;
+    std::string shape;
+    int frames;
+    int threads;
+    size_t references;
+    uint64_t pageFaults;
+    double seconds;
+    long peakRssKb;
+    double bytesPerFrame;
+};
+
+/**
+ * @brief Zera o pico de memoria residente, quando o sistema permite
+ *
+ * No Linux, escrever "5" em /proc/self/clear_refs reinicia o VmHWM; nos
+ * demais sistemas o pico reportado e o do processo inteiro. Com glibc, a
+ * memoria liberada pelas medicoes anteriores volta antes ao sistema, para
+ * nao ser reaproveitada sem aparecer no pico.
+ */
+static void resetPeakRss() {
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) {
+        clearRefs << "5";
+    }
+#endif
+}
+
+/**
+ * @brief Memoria residente atual em KB (0 se o sistema nao informa)
+ */
+static long getCurrentRssKb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long>(counters.WorkingSetSize / 1024);
+    }
+#elif defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            return std::atol(line.c_str() + 6);
+        }
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief Pico de memoria residente em KB
+ */
+static long getPeakRssKb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::atol(line.c_str() + 6);
+        }
+    }
+#endif
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+/**
+ * @brief Descreve a carga sintetica de um formato do benchmark
+ * @param shape loop, scan, zipf, random ou hit
+ * @param frames Numero de frames da medicao (define o universo de paginas)
+ * @param length Numero de referencias
+ */
+static WorkloadConfig makeWorkload(const std::string& shape, int frames, size_t length) {
+    WorkloadConfig workload;
+    workload.length = length;
+    workload.seed = SEED;
+    
+    // Universo maior que a memoria, para haver substituicoes
+    workload.pageCount = std::max(16, frames * 2);
+    
+    if (shape == "hit") {
+        workload.type = WorkloadType::LOOP;
+        workload.workingSetSize = std::max(1, frames / 2);
+    } else if (shape == "loop") {
+        // Laco um pouco maior que a memoria: pior caso de FIFO/Clock
+        workload.type = WorkloadType::LOOP;
+        workload.workingSetSize = frames + std::max(1, frames / 4);
+    } else if (shape == "scan") {
+        workload.type = WorkloadType::SCAN;
+        workload.pageCount = 0x7fffffff;
+    } else if (shape == "random") {
+        workload.type = WorkloadType::UNIFORM;
+    } else if (shape == "zipf") {
+        workload.type = WorkloadType::ZIPF;
+        workload.zipfAlpha = 1.0;
+    } else {
+        throw std::invalid_argument("Formato de trace desconhecido: " + shape);
+    }
+    
+    return workload;
+}
+
+/**
+ * @brief Executa uma medicao, repetindo e guardando o menor tempo
+ */
+static BenchResult measure(const BenchConfig& config, const std::string& suite,
+                           ReplayPolicy policy, const std::string& shape,
+                           int frames, const std::vector<int>& pages) {
+    BenchResult result;
+    result.suite = suite;
+    result.algorithm = TraceReplay::getPolicyName(policy);
+    result.shape = shape;
+    result.frames = frames;
+    result.threads = 1;
+    result.references = pages.size();
+    result.seconds = 0.0;
+    
+    resetPeakRss();
+    long baseRssKb = getCurrentRssKb();
+    for (int r = 0; r < config.repeat; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        AlgorithmStatistics stats = TraceReplay::replay(policy, frames, pages.data(), pages.size());
+        auto end = std::chrono::steady_clock::now();
+        
+        double seconds = std::chrono::duration<double>(end - start).count();
+        if (r == 0 || seconds < result.seconds) {
+            result.seconds = seconds;
+        }
+        result.pageFaults = stats.pageFaults;
+    }
+    result.peakRssKb = getPeakRssKb();
+    result.bytesPerFrame = std::max(0L, result.peakRssKb - baseRssKb) * 1024.0 / frames;
+    
+    return result;
+}
+
+/**
+ * @brief Mede o ConcurrentClock com varias threads sobre o mesmo trace
+ * @param pageCount Paginas do trace (IDs 0..pageCount-1)
+ */
+static BenchResult measureConcurrent(const BenchConfig& config, const std::string& shape,
+                                     int frames, int threads, int pageCount,
+                                     const std::vector<int>& pages) {
+    BenchResult result;
+    result.suite = "concurrent";
+    result.algorithm = "concurrent-clock";
+    result.shape = shape;
+    result.frames = frames;
+    result.threads = threads;
+    result.references = pages.size() * threads;
+    result.seconds = 0.0;
+    
+    std::vector<const int*> traces(threads, pages.data());
+    std::vector<size_t> counts(threads, pages.size());
+    
+    resetPeakRss();
+    long baseRssKb = getCurrentRssKb();
+    for (int r = 0; r < config.repeat; ++r) {
+        ConcurrentClock clock(frames, pageCount, threads);
+        double seconds = clock.replay(traces, counts);
+        if (r == 0 || seconds < result.seconds) {
+            result.seconds = seconds;
+        }
+        result.pageFaults = clock.getStatistics().pageFaults;
+    }
+    result.peakRssKb = getPeakRssKb();
+    result.bytesPerFrame = std::max(0L, result.peakRssKb - baseRssKb) * 1024.0 / frames;
+    
+    return result;
+}
+
+/**
+ * @brief Escreve os resultados em JSON (ordem de campos fixa)
+ */
+static void writeJson(std::ostream& os, const BenchConfig& config,
+                      const std::vector<BenchResult>& results) {
+    os << "{\n"
+       << "  \"schema\": \"" << SCHEMA << "\",\n"
+       << "  \"seed\": " << SEED << ",\n"
+       << "  \"frame_search\": \"" << FrameStore::getSearchName() << "\",\n"
+       << "  \"references\": " << config.references << ",\n"
+       << "  \"repeat\": " << config.repeat << ",\n"
+       << "  \"results\": [\n";
+    
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        double perSecond = r.seconds > 0.0 ? r.references / r.seconds : 0.0;
+        double nsPerRef = r.references > 0 ? r.seconds * 1e9 / r.references : 0.0;
+        
+        os << "    {\"suite\": \"" << r.suite << "\""
+           << ", \"algorithm\": \"" << r.algorithm << "\""
+           << ", \"shape\": \"" << r.shape << "\""
+           << ", \"frames\": " << r.frames
+           << ", \"threads\": " << r.threads
+           << ", \"references\": " << r.references
+           << ", \"page_faults\": " << r.pageFaults
+           << std::fixed << std::setprecision(6)
+           << ", \"seconds\": " << r.seconds
+           << std::setprecision(1)
+           << ", \"references_per_second\": " << perSecond
+           << std::setprecision(3)
+           << ", \"ns_per_reference\": " << nsPerRef
+           << ", \"peak_rss_kb\": " << r.peakRssKb
+           << std::setprecision(2)
+           << ", \"bytes_per_frame\": " << r.bytesPerFrame << "}"
+           << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    
+    os << "  ]\n}\n";
+}
+
+/**
+ * @brief Exibe a ajuda
+ */
+static void printUsage(std::ostream& os) {
+    os << "Uso: benchmark [opcoes]\n"
+       << "  --references N    Referencias minimas por trace (padrao: 1000000)\n"
+       << "  --max-frames N    Maior numero de frames (padrao: 4194304)\n"
+       << "  --repeat N        Repeticoes por medicao; vale a mais rapida (padrao: 1)\n"
+       << "  --quick           Execucao curta: 100000 referencias, ate 4096 frames\n"
+       << "  --output ARQUIVO  Grava o JSON em arquivo (padrao: stdout)\n";
+}
+
+/**
+ * @brief Converte texto em inteiro positivo
+ */
+static long parsePositive(const std::string& text, const std::string& option) {
+    char* end = nullptr;
+    long value = std::strtol(text.c_str(), &end, 10);
+    if (end == text.c_str() || *end != '\0' || value <= 0) {
+        throw std::invalid_argument("Valor invalido para " + option + ": " + text);
+    }
+    return value;
+}
+
+/**
+ * @brief Le as opcoes da linha de comando
+ * @return false se apenas a ajuda foi exibida
+ */
+static bool parseArguments(int argc, char* argv[], BenchConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        
+        if (arg == "--help" || arg == "-h") {
+            printUsage(std::cout);
+            return false;
+        }
+        if (arg == "--quick") {
+            config.references = 100000;
+            config.maxFrames = 4096;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("Opcao " + arg + " requer um valor");
+        }
+        std::string value = argv[++i];
+        
+        if (arg == "--references") {
+            config.references = static_cast<size_t>(parsePositive(value, arg));
+        } else if (arg == "--max-frames") {
+            config.maxFrames = static_cast<int>(std::min(parsePositive(value, arg), 0x7fffffffL));
+        } else if (arg == "--repeat") {
+            config.repeat = static_cast<int>(parsePositive(value, arg));
+        } else if (arg == "--output") {
+            config.outputFile = value;
+        } else {
+            throw std::invalid_argument("Opcao desconhecida: " + arg);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Executa as suites micro, macro, memory e concurrent e emite o JSON
+ */
+int main(int argc, char* argv[]) {
+    try {
+        BenchConfig config;
+        if (!parseArguments(argc, argv, config)) {
+            return 0;
+        }
+        
+        // Frames de 8 ate maxFrames, multiplicando por 8 (maxFrames sempre entra)
+        std::vector<int> frameCounts;
+        for (long frames = 8; frames <= config.maxFrames; frames *= 8) {
+            frameCounts.push_back(static_cast<int>(frames));
+        }
+        if (frameCounts.empty() || frameCounts.back() != config.maxFrames) {
+            frameCounts.push_back(config.maxFrames);
+        }
+        
+        const char* macroShapes[] = {"loop", "scan", "zipf", "random"};
+        std::vector<BenchResult> results;
+        
+        for (int frames : frameCounts) {
+            // O trace precisa de varias voltas pela memoria para sair do aquecimento
+            size_t length = std::max(config.references, static_cast<size_t>(frames) * 4);
+            
+            std::vector<int> hitTrace = WorkloadGenerator::materialize(makeWorkload("hit", frames, length));
+            for (ReplayPolicy policy : TraceReplay::getAllPolicies()) {
+                results.push_back(measure(config, "micro", policy, "hit", frames, hitTrace));
+            }
+            hitTrace = std::vector<int>();
+            
+            for (const char* shape : macroShapes) {
+                std::vector<int> pages = WorkloadGenerator::materialize(makeWorkload(shape, frames, length));
+                for (ReplayPolicy policy : TraceReplay::getAllPolicies()) {
+                    results.push_back(measure(config, "macro", policy, shape, frames, pages));
+                    std::cerr << "." << std::flush;
+                }
+            }
+        }
+        
+        // Enche a memoria e substitui cada frame uma vez
+        int largest = frameCounts.back();
+        std::vector<int> fillTrace = WorkloadGenerator::materialize(
+            makeWorkload("scan", largest, static_cast<size_t>(largest) * 2));
+        for (ReplayPolicy policy : TraceReplay::getAllPolicies()) {
+            results.push_back(measure(config, "memory", policy, "scan", largest, fillTrace));
+        }
+        fillTrace = std::vector<int>();
+        
+        // Threads 1, 2, 4, ... ate o numero de cores (que sempre entra)
+        int cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        std::vector<int> threadCounts;
+        for (int threads = 1; threads < cores; threads *= 2) {
+            threadCounts.push_back(threads);
+        }
+        threadCounts.push_back(cores);
+        
+        int sharedFrames = std::min(config.maxFrames, 4096);
+        for (const char* shape : {"hit", "zipf"}) {
+            WorkloadConfig workload = makeWorkload(shape, sharedFrames, config.references);
+            std::vector<int> pages = WorkloadGenerator::materialize(workload);
+            for (int threads : threadCounts) {
+                results.push_back(measureConcurrent(config, shape, sharedFrames, threads,
+                                                    workload.pageCount, pages));
+                std::cerr << "." << std::flush;
+            }
+        }
+        std::cerr << "\n";
+        
+        if (config.outputFile.empty()) {
+            writeJson(std::cout, config, results);
+        } else {
+            std::ofstream out(config.outputFile.c_str());
+            if (!out) {
+                throw std::runtime_error("Nao foi possivel criar o arquivo: " + config.outputFile);
+            }
+            writeJson(out, config, results);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "ERRO: " << e.what() << "\n";
+        return 1;
+    }
+    
+    return 0;
+}
@@ -1,12 +1,25 @@
 #include "../include/PageReplacementSimulator.h"
+#include "../include/BatchRunner.h"
 #include <iostream>
 
 /**
  * @brief Função principal do programa
+ * 
+ * Sem argumentos abre o menu interativo; com argumentos executa o
+ * modo batch (veja BatchRunner::printUsage).
+ * 
  * @return 0 se sucesso, 1 se erro
  */
-int main() {
+int main(int argc, char* argv[]) {
     try {
+        if (argc > 1) {
+            BatchRunner batchRunner;
+            if (!batchRunner.parseArguments(argc, argv)) {
+                return 0;
+            }
+            return batchRunner.run();
+        }
+        
         PageReplacementSimulator simulator;
         simulator.run();
     } catch (const std::exception& e) {
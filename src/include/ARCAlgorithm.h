@@ -0,0 +1,51 @@
+#ifndef ARC_ALGORITHM_H
+#define ARC_ALGORITHM_H
+
+#include "PageReplacementAlgorithm.h"
+#include "AdaptiveDirectory.h"
+#include <vector>
+
+/**
+ * @brief ARC (Adaptive Replacement Cache, Megiddo e Modha)
+ *
+ * As paginas residentes ficam em duas listas LRU: T1 (vistas uma vez
+ * desde que entraram) e T2 (vistas ao menos duas vezes). As paginas
+ * substituidas de cada uma continuam lembradas nas listas fantasmas B1 e
+ * B2, sem frame. O alvo p e o tamanho desejado de T1: um fault em pagina
+ * de B1 indica que T1 deveria ser maior e aumenta p; em B2, diminui. Uma
+ * varredura passa so por T1 e nao tira as paginas quentes de T2.
+ *
+ * O diretorio guarda no maximo 2 * frames paginas (residentes e
+ * fantasmas) e cada referencia e O(1).
+ */
+class ARCAlgorithm : public PageReplacementAlgorithm {
+private:
+    AdaptiveDirectory directory;
+    int target;                       // p: tamanho desejado de T1 (0..memorySize)
+    TargetHistory targetHistory;
+    
+    void replace(bool ghostInB2);
+    bool touchPage(int pageNumber);
+    void displayMemoryState() const;
+
+public:
+    explicit ARCAlgorithm(int size, bool debug = false);
+    ~ARCAlgorithm() override = default;
+    
+    // Implementacao dos metodos virtuais
+    bool referencePage(int pageNumber) override;
+    const AlgorithmStatistics& referencePages(const int* pages, size_t n,
+                                              uint8_t* outHitMask = nullptr) override;
+    void displayMemory() const override;
+    void displayStatistics() const override;
+    void reset() override;
+    std::string getAlgorithmName() const override { return "ARC (Adaptive Replacement Cache)"; }
+    
+    // Metodos especificos do ARC
+    int getTarget() const { return target; }
+    const TargetHistory& getTargetHistory() const { return targetHistory; }
+    const AdaptiveDirectory& getDirectory() const { return directory; }
+    std::vector<int> getCurrentPages() const;
+};
+
+#endif // ARC_ALGORITHM_H
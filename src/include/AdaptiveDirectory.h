@@ -0,0 +1,202 @@
+#ifndef ADAPTIVE_DIRECTORY_H
+#define ADAPTIVE_DIRECTORY_H
+
+#include "PageIndex.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Valor do alvo p em um ponto do replay
+ */
+struct TargetSample {
+    uint64_t step;    // Referencias processadas ate a amostra
+    int target;       // Valor de p
+};
+
+/**
+ * @brief Historico do alvo p em memoria limitada
+ *
+ * Amostra p a cada 'interval' referencias. Ao encher, descarta uma
+ * amostra sim, outra nao, e dobra o intervalo: o historico cobre o
+ * replay inteiro com no maximo CAPACITY amostras igualmente espacadas,
+ * e cada referencia custa um decremento.
+ */
+class TargetHistory {
+private:
+    std::vector<TargetSample> samples;
+    uint64_t interval;
+    uint64_t untilSample;
+    
+    void append(uint64_t step, int target);
+
+public:
+    static const size_t CAPACITY = 1024;
+    
+    TargetHistory() { clear(); }
+    
+    void tick(uint64_t step, int target) {
+        if (--untilSample == 0) {
+            append(step, target);
+        }
+    }
+    
+    void clear();
+    
+    const std::vector<TargetSample>& getSamples() const { return samples; }
+    uint64_t getInterval() const { return interval; }
+};
+
+/**
+ * @brief Diretorio de paginas do ARC e do CAR
+ *
+ * Guarda as paginas residentes (listas T1 e T2) e as fantasmas, ja
+ * substituidas mas ainda lembradas (B1 e B2). As entradas de todas as
+ * listas vem de um unico vetor de 2 * frames posicoes, o limite do
+ * diretorio nos dois algoritmos, e cada lista e duplamente encadeada
+ * pelos indices prev/next da propria entrada: inserir, remover e mover
+ * entre listas e O(1), sem alocacao. O indice pagina -> entrada e um
+ * PageIndex.
+ *
+ * O inicio de cada lista e a entrada mais antiga (LRU, ou a posicao do
+ * ponteiro nos relogios do CAR) e o fim, a mais recente. Entradas
+ * residentes ocupam um frame; ao ir para uma lista fantasma o frame
+ * volta para a reserva e e reaproveitado pela proxima pagina carregada.
+ */
+class AdaptiveDirectory {
+public:
+    enum ListId { T1 = 0, T2 = 1, B1 = 2, B2 = 3 };
+    
+    static const int NONE = -1;
+    
+    struct Entry {
+        int page;
+        int frame;            // Frame ocupado (NONE nas listas fantasmas)
+        int prev;             // Entrada mais antiga da lista ou NONE
+        int next;             // Entrada mais recente da lista ou NONE
+        uint8_t list;         // ListId
+        uint8_t referenced;   // Bit de referencia (so o CAR usa)
+    };
+
+private:
+    struct List {
+        int head;
+        int tail;
+        int size;
+    };
+    
+    int frameCount;
+    std::vector<Entry> entries;
+    std::vector<int> freeEntries;     // Pilha de entradas livres
+    std::vector<int> freeFrames;      // Pilha de frames livres
+    List lists[4];
+    PageIndex<int> index;             // Pagina -> entrada
+    
+    void link(int entry, ListId list) {
+        Entry& node = entries[entry];
+        List& target = lists[list];
+        node.list = static_cast<uint8_t>(list);
+        node.prev = target.tail;
+        node.next = NONE;
+        if (target.tail != NONE) {
+            entries[target.tail].next = entry;
+        } else {
+            target.head = entry;
+        }
+        target.tail = entry;
+        target.size++;
+    }
+    
+    int takeFrame() {
+        int frame = freeFrames.back();
+        freeFrames.pop_back();
+        return frame;
+    }
+    
+    void unlink(int entry) {
+        Entry& node = entries[entry];
+        List& source = lists[node.list];
+        if (node.prev != NONE) {
+            entries[node.prev].next = node.next;
+        } else {
+            source.head = node.next;
+        }
+        if (node.next != NONE) {
+            entries[node.next].prev = node.prev;
+        } else {
+            source.tail = node.prev;
+        }
+        source.size--;
+    }
+
+public:
+    explicit AdaptiveDirectory(int frames);
+    
+    AdaptiveDirectory(const AdaptiveDirectory&) = delete;
+    AdaptiveDirectory& operator=(const AdaptiveDirectory&) = delete;
+    
+    // Entrada da pagina (residente ou fantasma), ou NONE
+    int find(int page) const { return index.find(page); }
+    
+    static bool isResident(const Entry& entry) { return entry.list <= T2; }
+    
+    // Nova entrada no fim da lista; listas residentes ocupam um frame livre
+    int insert(int page, ListId list) {
+        int entry = freeEntries.back();
+        freeEntries.pop_back();
+        Entry& node = entries[entry];
+        node.page = page;
+        node.frame = NONE;
+        if (list <= T2) {
+            node.frame = takeFrame();
+        }
+        node.referenced = 0;
+        link(entry, list);
+        index.insert(page, entry);
+        return entry;
+    }
+    
+    // Move a entrada para o fim da lista, ocupando ou liberando o frame
+    void move(int entry, ListId list) {
+        unlink(entry);
+        Entry& node = entries[entry];
+        bool wasResident = isResident(node);
+        if (wasResident && list > T2) {
+            freeFrames.push_back(node.frame);
+            node.frame = NONE;
+        } else if (!wasResident && list <= T2) {
+            node.frame = takeFrame();
+        }
+        link(entry, list);
+    }
+    
+    // Esquece a pagina, liberando o frame se ela estiver residente
+    void erase(int entry) {
+        unlink(entry);
+        Entry& node = entries[entry];
+        if (isResident(node)) {
+            freeFrames.push_back(node.frame);
+        }
+        index.erase(node.page);
+        freeEntries.push_back(entry);
+    }
+    
+    Entry& operator[](int entry) { return entries[entry]; }
+    const Entry& operator[](int entry) const { return entries[entry]; }
+    
+    int front(ListId list) const { return lists[list].head; }
+    int size(ListId list) const { return lists[list].size; }
+    int getResidentCount() const { return lists[T1].size + lists[T2].size; }
+    int getEntryCount() const { return getResidentCount() + lists[B1].size + lists[B2].size; }
+    int getFrameCount() const { return frameCount; }
+    
+    // Paginas da lista, da mais antiga para a mais recente
+    std::vector<int> getPages(ListId list) const;
+    
+    // Imprime T1, T2, B1 e B2; com referenceBits, marca com * os bits ligados
+    void display(bool referenceBits) const;
+    
+    void clear();
+};
+
+#endif // ADAPTIVE_DIRECTORY_H
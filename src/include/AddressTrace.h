@@ -0,0 +1,80 @@
+#ifndef ADDRESS_TRACE_H
+#define ADDRESS_TRACE_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Formatos de trace de enderecos aceitos pelo importador
+ */
+enum class AddressFormat {
+    LACKEY,     // valgrind --tool=lackey --trace-mem=yes: " L 04f6b868,8"
+    PERF_MEM,   // perf mem report -D: PID TID IP ADDR ... (espaco ou -x ,)
+    RAW         // Enderecos uint64 little-endian, sem cabecalho
+};
+
+/**
+ * @brief Parametros da importacao
+ */
+struct AddressTraceOptions {
+    AddressFormat format;
+    uint64_t pageSize;        // Potencia de 2 (4K, 16K, 2M, ...)
+    int addressBits;          // Bits significativos do endereco (tags acima sao descartadas)
+    int threadCount;          // Threads do parsing (0 = numero de cores)
+    
+    AddressTraceOptions() : format(AddressFormat::LACKEY), pageSize(4096),
+                            addressBits(64), threadCount(0) {}
+};
+
+/**
+ * @brief Resultado de uma importacao
+ */
+struct AddressTraceImport {
+    std::vector<int64_t> pages;   // Numero de pagina de cada acesso, na ordem do trace
+    uint64_t skippedLines;        // Linhas nao reconhecidas (saida do programa, etc.)
+    
+    AddressTraceImport() : skippedLines(0) {}
+};
+
+/**
+ * @brief Importa traces de enderecos e os converte em numeros de pagina
+ *
+ * O arquivo e dividido em blocos alinhados em fim de linha, analisados em
+ * paralelo no WorkStealingPool. Cada bloco produz um vetor de enderecos;
+ * a conversao endereco -> pagina ((endereco & mascara) >> log2(pagina))
+ * roda depois, sobre vetores contiguos, com AVX2 ou SSE2 (4 ou 2
+ * enderecos por instrucao) escolhidos em tempo de execucao. Os IDs de
+ * pagina sao de 64 bits e seguem para o SparsePageMap.
+ */
+class AddressTrace {
+private:
+    typedef void (*PageFunction)(const uint64_t* addresses, size_t count,
+                                 uint64_t mask, int shift, int64_t* pages);
+    
+    static PageFunction convert;          // Implementacao escolhida para a CPU
+    static const char* convertName;
+    
+    static PageFunction selectConvert();
+
+public:
+    static const uint64_t MIN_PAGE_SIZE = 512;
+    
+    static AddressTraceImport import(const std::string& path, const AddressTraceOptions& options);
+    
+    // pages[i] = (addresses[i] & mask) >> shift
+    static void toPages(const uint64_t* addresses, size_t count,
+                        uint64_t mask, int shift, int64_t* pages);
+    
+    static bool parseFormat(const std::string& name, AddressFormat& format);
+    static std::string getFormatName(AddressFormat format);
+    
+    // Aceita bytes ou sufixos K/M/G (ex.: 4K, 16K, 2M); exige potencia de 2
+    static bool parsePageSize(const std::string& text, uint64_t& pageSize);
+    
+    // Nome da conversao em uso ("avx2", "sse2" ou "scalar")
+    static const char* getConvertName();
+};
+
+#endif // ADDRESS_TRACE_H
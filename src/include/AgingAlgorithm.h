@@ -0,0 +1,76 @@
+#ifndef AGING_ALGORITHM_H
+#define AGING_ALGORITHM_H
+
+#include "PageReplacementAlgorithm.h"
+#include "PageIndex.h"
+#include <vector>
+
+/**
+ * @brief Aging (NFU com contadores deslocados)
+ *
+ * Cada frame tem um contador de 8 bits, todos em um vetor contiguo. A
+ * referencia liga o bit mais alto do contador (o bit de referencia do
+ * intervalo atual); a cada tickInterval referencias todos os contadores
+ * sao deslocados um bit para a direita, de modo que o contador guarda as
+ * referencias dos ultimos 8 intervalos, as mais recentes valendo mais.
+ * A vitima e o frame de menor contador; empates saem na ordem circular a
+ * partir da ultima vitima.
+ *
+ * O deslocamento e a busca do menor contador percorrem o vetor inteiro
+ * com SSE2/AVX2 (16/32 frames por instrucao, escolhido na inicializacao);
+ * o hit e O(1) pelo PageIndex. Como hits so aumentam contadores e o
+ * deslocamento preserva a ordem entre eles, um limite inferior do menor
+ * contador e mantido entre faults: enquanto algum frame o tiver, a
+ * vitima sai de um memchr, sem percorrer todos os contadores.
+ */
+class AgingAlgorithm : public PageReplacementAlgorithm {
+private:
+    typedef void (*ShiftFunction)(uint8_t* counters, size_t count);
+    typedef uint8_t (*MinimumFunction)(const uint8_t* counters, size_t count);
+    
+    static const uint8_t REFERENCED = 0x80;
+    
+    std::vector<int> pages;            // Pagina de cada frame (-1 se vazio)
+    std::vector<uint8_t> counters;     // Contador de envelhecimento de cada frame
+    int loadedFrames;                  // Frames ja ocupados (os vazios sao o sufixo)
+    int tickInterval;                  // Referencias entre deslocamentos
+    int untilTick;                     // Referencias ate o proximo deslocamento
+    int nextVictim;                    // Inicio da busca circular no proximo fault
+    uint8_t lowestHint;                // Limite inferior do menor contador
+    uint64_t ticks;
+    PageIndex<int> pageTable;          // Indice pagina -> frame
+    
+    static ShiftFunction shift;        // Implementacoes escolhidas para a CPU
+    static MinimumFunction minimum;
+    static const char* kernelName;
+    
+    static ShiftFunction selectShift();
+    
+    int findCounter(uint8_t value) const;
+    int findVictim();
+    bool touchPage(int pageNumber);
+    void displayMemoryState() const;
+
+public:
+    // tickInterval 0 = uma volta pela memoria (memorySize referencias)
+    explicit AgingAlgorithm(int size, bool debug = false, int tickInterval = 0);
+    ~AgingAlgorithm() override = default;
+    
+    // Implementacao dos metodos virtuais
+    bool referencePage(int pageNumber) override;
+    const AlgorithmStatistics& referencePages(const int* pages, size_t n,
+                                              uint8_t* outHitMask = nullptr) override;
+    void displayMemory() const override;
+    void reset() override;
+    std::string getAlgorithmName() const override { return "Aging (NFU com Envelhecimento)"; }
+    
+    // Metodos especificos do Aging
+    std::vector<int> getCurrentPages() const;
+    int getTickInterval() const { return tickInterval; }
+    uint64_t getTicks() const { return ticks; }
+    
+    // Implementacao vetorial em uso ("avx2", "sse2" ou "scalar")
+    static const char* getKernelName();
+};
+
+#endif // AGING_ALGORITHM_H
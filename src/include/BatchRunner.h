@@ -0,0 +1,209 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include "TraceReplay.h"
+#include "TraceStream.h"
+#include "Logger.h"
+#include "AddressTrace.h"
+#include "ReplayEngine.h"
+#include "DifferentialFuzzer.h"
+#include "SparsePageMap.h"
+#include "ShardedClock.h"
+#include "TwoHandedClock.h"
+#include <vector>
+#include <string>
+#include <ostream>
+
+/**
+ * @brief Formato da saida do modo batch
+ */
+enum class OutputFormat {
+    CSV,
+    JSON
+};
+
+/**
+ * @brief Parametros do modo batch (lidos da linha de comando)
+ */
+struct BatchConfig {
+    std::vector<std::string> traceFiles;
+    std::vector<std::string> workloads;   // Cargas sinteticas (especificacao do WorkloadGenerator)
+    std::vector<ReplayPolicy> policies;
+    std::vector<int> frameCounts;
+    int64_t virtualMemorySize;  // 0 = sem limite superior (IDs de 64 bits)
+    OutputFormat format;
+    std::string outputFile;   // Vazio = saida padrao
+    std::string convertFile;  // Se definido, apenas converte o trace para binario
+    bool importAddresses;     // Traces sao de enderecos (--import), nao de paginas
+    AddressTraceOptions addressOptions;
+    bool streaming;           // Le traces binarios em blocos (memoria constante)
+    size_t chunkSize;         // Paginas por bloco no modo streaming
+    int threadCount;          // Threads da varredura (0 = numero de cores)
+    int curveFrames;          // > 0: emite curvas LRU/OPT para 1..curveFrames frames
+    uint64_t fuzzCases;       // > 0: fuzzing diferencial Clock x Segunda Chance
+    uint64_t fuzzSeed;
+    bool concurrent;          // Um trace por thread sobre um Clock compartilhado
+    int shards;               // > 0: Clock particionado em shards, comparado ao global
+    size_t epochLength;       // Referencias entre rebalanceamentos dos shards (0 = cotas fixas)
+    bool pageDaemon;          // Clock de dois ponteiros com daemon, comparado ao Clock
+    PageDaemonOptions daemonOptions;
+    LogLevel logLevel;        // Eventos de diagnostico (padrao: desligado)
+    std::string logFile;      // Destino do log (vazio = stderr)
+    
+    BatchConfig() : virtualMemorySize(0), format(OutputFormat::CSV),
+                    importAddresses(false), streaming(false), chunkSize(TraceStream::DEFAULT_CHUNK_SIZE),
+                    threadCount(0), curveFrames(0), fuzzCases(0), fuzzSeed(1), concurrent(false),
+                    shards(0), epochLength(ShardOptions().epochLength), pageDaemon(false),
+                    logLevel(LogLevel::OFF) {}
+};
+
+/**
+ * @brief Resultado de uma execucao (trace, politica, frames)
+ */
+struct BatchResult {
+    std::string traceFile;
+    ReplayPolicy policy;
+    int frames;
+    uint64_t invalidReferences;
+    AlgorithmStatistics stats;
+    double wallSeconds;
+    std::vector<TargetSample> targetHistory;   // Alvo p (so ARC e CAR; emitido no JSON)
+    
+    double getReferencesPerSecond() const {
+        return wallSeconds > 0.0 ? stats.totalReferences / wallSeconds : 0.0;
+    }
+};
+
+/**
+ * @brief Curva de page faults x frames de um trace (modo --mrc)
+ */
+struct CurveResult {
+    std::string traceFile;
+    std::string algorithm;          // "lru" ou "optimal"
+    uint64_t references;
+    std::vector<uint64_t> faults;   // faults[c - 1] = page faults com c frames
+    double wallSeconds;
+};
+
+/**
+ * @brief Replay concorrente (modo --concurrent): um trace por thread
+ */
+struct ConcurrentResult {
+    std::vector<std::string> traceFiles;          // traceFiles[t] = trace da thread t
+    int frames;
+    uint64_t invalidReferences;
+    std::vector<AlgorithmStatistics> threadStats; // Contadores de cada thread
+    AlgorithmStatistics stats;                    // Soma das threads
+    double wallSeconds;
+};
+
+/**
+ * @brief Clock particionado (modo --shards) e o Clock global equivalente
+ */
+struct ShardedResult {
+    std::string traceFile;
+    int frames;
+    uint64_t invalidReferences;
+    std::vector<ShardStatistics> shardStats;  // Estatisticas e cota final de cada shard
+    AlgorithmStatistics stats;                // Soma dos shards
+    uint64_t migratedFrames;
+    double wallSeconds;
+    AlgorithmStatistics globalStats;          // Um unico Clock com o total de frames
+    double globalSeconds;
+    
+    // Diferenca de page faults em relacao ao Clock global (%)
+    double getFaultDifference() const {
+        return globalStats.pageFaults > 0
+            ? ((double)stats.pageFaults - (double)globalStats.pageFaults) / globalStats.pageFaults * 100.0
+            : 0.0;
+    }
+};
+
+/**
+ * @brief Latencia de fault e trabalho do daemon (modo --page-daemon)
+ */
+struct DaemonResult {
+    std::string traceFile;
+    std::string algorithm;          // "clock", "two-handed" ou "two-handed-inline"
+    int frames;
+    uint64_t invalidReferences;
+    int handSpread;                 // 0 no Clock (sem daemon)
+    int lowWatermark;
+    int highWatermark;
+    AlgorithmStatistics stats;
+    LatencyHistogram faultLatency;  // Tempo de cada fault na thread da aplicacao
+    uint64_t stalls;                // Faults que esperaram o daemon
+    PageDaemonStatistics daemon;
+    double wallSeconds;
+};
+
+/**
+ * @brief Modo nao interativo: executa traces e emite CSV/JSON
+ *
+ * Nao usa SimulatorUI nem log por referencia, permitindo rodar o
+ * simulador em jobs de lote.
+ */
+class BatchRunner {
+private:
+    BatchConfig config;
+    std::vector<BatchResult> results;
+    std::vector<CurveResult> curves;
+    FuzzReport fuzzReport;
+    std::vector<ConcurrentResult> concurrentResults;
+    std::vector<ShardedResult> shardedResults;
+    std::vector<DaemonResult> daemonResults;
+    
+    std::vector<int64_t> loadTrace(const std::string& path) const;
+    std::vector<int64_t> loadPageIds(const std::string& path) const;
+    bool isValidPage(int64_t page) const;
+    uint64_t countInvalidPages(const int* pages, size_t count) const;
+    std::vector<int> copyValidPages(const int* pages, size_t count) const;
+    std::vector<int> compactPages(const int64_t* ids, size_t count, uint64_t& invalid) const;
+    int convertTrace();
+    const int* openTrace(const std::string& traceFile, MappedTrace& mapped,
+                         std::vector<int>& loaded, size_t& count, uint64_t& invalid) const;
+    void runStreaming(const std::string& traceFile);
+    void runStreamingWorkload(const std::string& spec);
+    void addCombinations(ReplayEngine& engine) const;
+    void collectResults(const std::string& traceFile, const ReplayEngine& engine, uint64_t invalid);
+    void runSweep(const std::string& traceFile, const int* pages, size_t count, uint64_t invalid);
+    void runCurves(const std::string& traceFile, const int* pages, size_t count);
+    void runFuzz();
+    void runConcurrent();
+    void internTrace(const std::string& traceFile, SparsePageMap& pageMap,
+                     std::vector<int>& pages, uint64_t& invalid) const;
+    void runSharded(const std::string& traceFile, const int* pages, size_t count, uint64_t invalid);
+    void runPageDaemon(const std::string& traceFile, const int* pages, size_t count, uint64_t invalid);
+    
+    void writeOutput(std::ostream& os) const;
+    void writeCsv(std::ostream& os) const;
+    void writeJson(std::ostream& os) const;
+    void writeCurveCsv(std::ostream& os) const;
+    void writeCurveJson(std::ostream& os) const;
+    void writeFuzzCsv(std::ostream& os) const;
+    void writeFuzzJson(std::ostream& os) const;
+    void writeConcurrentCsv(std::ostream& os) const;
+    void writeConcurrentJson(std::ostream& os) const;
+    void writeShardedCsv(std::ostream& os) const;
+    void writeShardedJson(std::ostream& os) const;
+    void writeDaemonCsv(std::ostream& os) const;
+    void writeDaemonJson(std::ostream& os) const;
+
+public:
+    BatchRunner() = default;
+    
+    // Retorna false se apenas a ajuda foi solicitada
+    bool parseArguments(int argc, char* argv[]);
+    int run();
+    
+    const std::vector<BatchResult>& getResults() const { return results; }
+    const std::vector<CurveResult>& getCurves() const { return curves; }
+    const FuzzReport& getFuzzReport() const { return fuzzReport; }
+    const std::vector<ConcurrentResult>& getConcurrentResults() const { return concurrentResults; }
+    const std::vector<ShardedResult>& getShardedResults() const { return shardedResults; }
+    const std::vector<DaemonResult>& getDaemonResults() const { return daemonResults; }
+    
+    static void printUsage(std::ostream& os);
+};
+
+#endif // BATCH_RUNNER_H
@@ -0,0 +1,52 @@
+#ifndef CAR_ALGORITHM_H
+#define CAR_ALGORITHM_H
+
+#include "PageReplacementAlgorithm.h"
+#include "AdaptiveDirectory.h"
+#include <vector>
+
+/**
+ * @brief CAR (Clock with Adaptive Replacement, Bansal e Modha)
+ *
+ * Aplica a adaptacao do ARC a dois relogios: T1 (paginas vistas uma
+ * vez) e T2 (vistas de novo depois de sair para B1/B2 ou de ganhar uma
+ * segunda chance em T1). O hit so liga o bit de referencia, como no
+ * Clock, sem mexer em listas. Na substituicao, o ponteiro de T1 (se T1
+ * tiver ao menos p paginas) ou o de T2 avanca: pagina com bit ligado
+ * perde o bit e vai para o fim de T2; a primeira com bit desligado sai
+ * para a fantasma B1 ou B2. Faults em B1 aumentam p e em B2 o diminuem.
+ *
+ * O diretorio guarda no maximo 2 * frames paginas. O hit e O(1) e a
+ * substituicao e O(1) amortizado: cada bit ligado e limpo uma vez.
+ */
+class CARAlgorithm : public PageReplacementAlgorithm {
+private:
+    AdaptiveDirectory directory;
+    int target;                       // p: tamanho desejado de T1 (0..memorySize)
+    TargetHistory targetHistory;
+    
+    void replace();
+    bool touchPage(int pageNumber);
+    void displayMemoryState() const;
+
+public:
+    explicit CARAlgorithm(int size, bool debug = false);
+    ~CARAlgorithm() override = default;
+    
+    // Implementacao dos metodos virtuais
+    bool referencePage(int pageNumber) override;
+    const AlgorithmStatistics& referencePages(const int* pages, size_t n,
+                                              uint8_t* outHitMask = nullptr) override;
+    void displayMemory() const override;
+    void displayStatistics() const override;
+    void reset() override;
+    std::string getAlgorithmName() const override { return "CAR (Clock with Adaptive Replacement)"; }
+    
+    // Metodos especificos do CAR
+    int getTarget() const { return target; }
+    const TargetHistory& getTargetHistory() const { return targetHistory; }
+    const AdaptiveDirectory& getDirectory() const { return directory; }
+    std::vector<int> getCurrentPages() const;
+};
+
+#endif // CAR_ALGORITHM_H
@@ -2,35 +2,10 @@
 #define CLOCK_ALGORITHM_H
 
 #include "PageReplacementAlgorithm.h"
+#include "FrameStore.h"
+#include "PageIndex.h"
 #include <vector>
 
-/**
- * @brief Representa um frame na memoria fisica
- */
-class Frame {
-public:
-    int pageNumber;     // Numero da pagina (-1 se vazio)
-    bool referenceBit;  // Bit de referencia (true = referenciado recentemente)
-    bool valid;         // Frame esta ocupado?
-
-    // Construtor
-    Frame() : pageNumber(-1), referenceBit(false), valid(false) {}
-    
-    // Construtor com parametros
-    Frame(int page, bool refBit = true) 
-        : pageNumber(page), referenceBit(refBit), valid(true) {}
-
-    // Verifica se o frame esta vazio
-    bool isEmpty() const { return !valid; }
-    
-    // Limpa o frame
-    void clear() {
-        pageNumber = -1;
-        referenceBit = false;
-        valid = false;
-    }
-};
-
 /**
  * @brief Implementacao do Algoritmo Clock (Buffer Circular)
  * 
@@ -39,14 +14,19 @@ public:
  */
 class ClockAlgorithm : public PageReplacementAlgorithm {
 private:
-    std::vector<Frame> frames;    // Frames de memoria fisica
+    FrameStore frames;            // Frames de memoria fisica (layout SoA)
     int clockHand;                // Ponteiro do relogio (posicao atual)
+    int loadedFrames;             // Frames ja ocupados (os vazios sao o sufixo)
+    bool useIndex;                // Memoria grande: busca pelo indice em vez de SIMD
+    PageIndex<int> pageTable;       // Indice pagina -> frame (se useIndex)
 
     // Metodos privados
     int findPage(int pageNumber) const;
     int findEmptyFrame() const;
     int getNextClockPosition() const;
     void advanceClock();
+    void loadPage(int frameIndex, int pageNumber);
+    bool touchPage(int pageNumber);
 
 public:
     // Construtor
@@ -57,12 +37,18 @@ public:
 
     // Implementacao dos metodos virtuais
     bool referencePage(int pageNumber) override;
+    const AlgorithmStatistics& referencePages(const int* pages, size_t n,
+                                              uint8_t* outHitMask = nullptr) override;
     void displayMemory() const override;
     void reset() override;
     std::string getAlgorithmName() const override { return "Clock (Buffer Circular)"; }
     
     // Metodos especificos do Clock
     int getClockPosition() const { return clockHand; }
+    std::vector<int> getCurrentPages() const;
+    
+    // Muda o numero de frames; ao encolher, o relogio escolhe quem sai
+    void resize(int size);
     
     // Operadores para facilitar uso
     friend std::ostream& operator<<(std::ostream& os, const ClockAlgorithm& clock);
@@ -0,0 +1,78 @@
+#ifndef CONCURRENT_CLOCK_H
+#define CONCURRENT_CLOCK_H
+
+#include "PageReplacementAlgorithm.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Clock compartilhado por varias threads (pool de frames unico)
+ *
+ * Modela threads de uma aplicacao tocando o mesmo conjunto de frames:
+ *   - Hit: le o indice pagina -> frame e liga o bit de referencia
+ *     atomico (so escreve se ele estiver desligado); sem locks.
+ *   - Fault: a thread reserva a pagina (CAS de NOT_RESIDENT para
+ *     LOADING; quem chegar depois espera a carga e conta hit) e pega um
+ *     frame livre ou avanca o ponteiro com fetch_add. Cada frame
+ *     examinado tem o bit zerado ou, se ja estava zerado, e reservado
+ *     por CAS e vira a vitima. O unico ponto serializado e o avanco do
+ *     ponteiro.
+ *   - Estatisticas: contadores por thread, cada um em sua linha de
+ *     cache, somados apenas na leitura.
+ *
+ * As paginas sao IDs densos 0..pageCount-1 (o indice e um vetor
+ * direto). Com uma unica thread as decisoes sao as mesmas do
+ * ClockAlgorithm. Um hit concorrente com a substituicao da propria
+ * pagina conta como hit anterior a ela, e o bit ligado pode cair no
+ * frame ja reaproveitado: e a mesma imprecisao do bit de hardware.
+ */
+class ConcurrentClock {
+private:
+    static const int NOT_RESIDENT = -1;   // pageFrame: pagina fora da memoria
+    static const int LOADING = -2;        // pageFrame: carga em andamento
+    static const int FREE = -1;           // framePage: frame nunca usado
+    static const int BUSY = -2;           // framePage: frame reservado para carga
+    
+    // Contadores de uma thread. 128 bytes: mesmo sem o vetor alinhado em
+    // 64, os contadores de duas threads nunca dividem uma linha de cache
+    struct ThreadCounters {
+        AlgorithmStatistics stats;
+        char padding[128 - sizeof(AlgorithmStatistics)];
+    };
+    
+    int memorySize;
+    int pageCount;
+    std::unique_ptr<std::atomic<int>[]> pageFrame;          // Pagina -> frame, NOT_RESIDENT ou LOADING
+    std::unique_ptr<std::atomic<int>[]> framePage;          // Frame -> pagina, FREE ou BUSY
+    std::unique_ptr<std::atomic<uint8_t>[]> referenceBits;  // Um byte por frame
+    std::atomic<int> loadedFrames;                          // Frames livres sao o sufixo
+    std::atomic<uint64_t> clockHand;                        // Posicao = clockHand % memorySize
+    std::vector<ThreadCounters> counters;
+    
+    int claimFrame();
+
+public:
+    ConcurrentClock(int frames, int pageCount, int threadCount);
+    
+    ConcurrentClock(const ConcurrentClock&) = delete;
+    ConcurrentClock& operator=(const ConcurrentClock&) = delete;
+    
+    // Seguro para chamadas simultaneas com threads distintas
+    bool referencePage(int thread, int pageNumber);
+    
+    // Uma thread por trace, todas liberadas juntas; retorna o tempo em segundos
+    double replay(const std::vector<const int*>& traces, const std::vector<size_t>& counts);
+    
+    // Nao pode ser chamado durante o replay
+    void reset();
+    
+    AlgorithmStatistics getStatistics() const;
+    const AlgorithmStatistics& getThreadStatistics(int thread) const { return counters[thread].stats; }
+    int getMemorySize() const { return memorySize; }
+    int getThreadCount() const { return static_cast<int>(counters.size()); }
+};
+
+#endif // CONCURRENT_CLOCK_H
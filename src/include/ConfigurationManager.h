@@ -9,7 +9,7 @@
  */
 struct SimulatorConfig {
     int physicalMemorySize;
-    int virtualMemorySize;
+    int virtualMemorySize;  // 0 = espaco esparso de 64 bits
     bool debugMode;
     AlgorithmType currentAlgorithm;
     
@@ -0,0 +1,94 @@
+#ifndef DIFFERENTIAL_FUZZER_H
+#define DIFFERENTIAL_FUZZER_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Parametros de uma rodada de fuzzing diferencial
+ */
+struct FuzzOptions {
+    uint64_t cases;               // Numero de sequencias geradas
+    uint64_t seed;                // Semente da rodada (caso i usa seed e i)
+    int threadCount;              // Threads (0 = numero de cores)
+    std::vector<int> frameCounts; // Vazio = 1..DEFAULT_MAX_FRAMES
+    size_t maxLength;             // Referencias por sequencia (maximo)
+    
+    FuzzOptions() : cases(1000000), seed(1), threadCount(0), maxLength(32) {}
+};
+
+/**
+ * @brief Primeira divergencia encontrada entre Clock e Segunda Chance
+ */
+struct FuzzDivergence {
+    uint64_t caseIndex;           // Caso que divergiu (reproduzivel pela semente)
+    int frames;                   // Frames do caso
+    std::vector<int> sequence;    // Sequencia gerada
+    int minimizedFrames;          // Menor numero de frames que ainda diverge
+    std::vector<int> minimized;   // Menor sequencia que ainda diverge
+    size_t step;                  // Referencia da sequencia minimizada que diverge
+    std::string reason;
+    
+    FuzzDivergence() : caseIndex(0), frames(0), minimizedFrames(0), step(0) {}
+};
+
+/**
+ * @brief Resultado de uma rodada
+ */
+struct FuzzReport {
+    uint64_t cases;
+    uint64_t references;
+    bool diverged;
+    FuzzDivergence divergence;    // Valido se diverged
+    double wallSeconds;
+    
+    FuzzReport() : cases(0), references(0), diverged(false), wallSeconds(0.0) {}
+    
+    double getCasesPerSecond() const {
+        return wallSeconds > 0.0 ? cases / wallSeconds : 0.0;
+    }
+};
+
+/**
+ * @brief Fuzzing diferencial entre ClockAlgorithm e SecondChanceAlgorithm
+ *
+ * Os dois algoritmos devem tomar as mesmas decisoes de substituicao
+ * (docs/SecondChanceXClock.md). Cada thread gera sequencias curtas,
+ * aleatorias e adversariais (lacos de frames + 1 paginas, voltas
+ * completas do ponteiro, paginas quentes e frias), e as aplica aos dois
+ * algoritmos em passo sincronizado. A cada referencia os dois precisam
+ * concordar em hit ou fault e, a cada fault, na pagina substituida: como
+ * ambos comecam vazios, isso mantem os conjuntos residentes iguais apos
+ * cada fault, sem percorrer os frames. Ao fim do caso os conjuntos sao
+ * comparados por inteiro. As instancias sao reaproveitadas com reset(),
+ * sem alocacao por caso. A primeira divergencia e reduzida (remocao de
+ * trechos, depois de referencias isoladas, depois menos frames) ate a
+ * menor sequencia que ainda diverge.
+ */
+class DifferentialFuzzer {
+private:
+    FuzzOptions options;
+
+public:
+    static const int DEFAULT_MAX_FRAMES = 8;
+    static const uint64_t CASES_PER_TASK = 1 << 14;
+    
+    explicit DifferentialFuzzer(const FuzzOptions& options);
+    
+    FuzzReport run();
+    
+    // Sequencia do caso (deterministica para a semente e o indice)
+    static void generate(uint64_t seed, uint64_t caseIndex, int frames,
+                         size_t maxLength, std::vector<int>& sequence);
+    
+    // Referencia em que os algoritmos divergem, ou -1 se concordam
+    static long long findDivergence(int frames, const int* pages, size_t count,
+                                    std::string* reason = nullptr);
+    
+    // Reduz uma sequencia divergente; frames pode diminuir
+    static std::vector<int> minimize(const std::vector<int>& sequence, int& frames);
+};
+
+#endif // DIFFERENTIAL_FUZZER_H
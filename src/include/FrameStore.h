@@ -0,0 +1,129 @@
+#ifndef FRAME_STORE_H
+#define FRAME_STORE_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Frame compactado em uma palavra de 32 bits
+ *
+ * Bit 31 guarda o bit de referencia e os bits 0-30 o numero da pagina;
+ * com todos os bits de pagina ligados (EMPTY) o frame esta vazio. Cabem
+ * paginas de 0 ate MAX_PAGE em 4 bytes, sem o preenchimento de uma
+ * struct com int e bool.
+ */
+class PackedFrame {
+private:
+    uint32_t word;
+
+public:
+    static const uint32_t REFERENCE_BIT = 0x80000000u;
+    static const uint32_t PAGE_MASK = 0x7fffffffu;
+    static const uint32_t EMPTY = PAGE_MASK;
+    static const int MAX_PAGE = 0x7ffffffe;
+    
+    // Frame vazio
+    PackedFrame() : word(EMPTY) {}
+    
+    // Frame ocupado pela pagina (0 <= page <= MAX_PAGE)
+    explicit PackedFrame(int page, bool refBit = true)
+        : word(static_cast<uint32_t>(page) | (refBit ? REFERENCE_BIT : 0)) {}
+    
+    bool isEmpty() const { return (word & PAGE_MASK) == EMPTY; }
+    int getPage() const { return static_cast<int>(word & PAGE_MASK); }
+    bool getReferenceBit() const { return (word & REFERENCE_BIT) != 0; }
+    
+    void setReferenceBit() { word |= REFERENCE_BIT; }
+    void clearReferenceBit() { word &= PAGE_MASK; }
+    void clear() { word = EMPTY; }
+};
+
+/**
+ * @brief Frames em layout de estrutura de arrays (SoA)
+ *
+ * Os numeros de pagina ficam contiguos em um vetor de int e os bits de
+ * referencia e de validade em mapas de bits de 64 bits. A busca por
+ * pagina percorre o vetor com comparacoes SIMD (AVX2 ou SSE2, 8 ou 4
+ * paginas por instrucao), escolhidas em tempo de execucao conforme a
+ * CPU; em outras arquiteturas usa um laco escalar.
+ */
+class FrameStore {
+private:
+    typedef int (*SearchFunction)(const int* pages, int count, int page);
+    
+    std::vector<int> pages;               // Pagina de cada frame (-1 se vazio)
+    std::vector<uint64_t> referenceBits;  // Bit i = bit de referencia do frame i
+    std::vector<uint64_t> validBits;      // Bit i = frame i ocupado
+    int frameCount;
+    
+    static SearchFunction search;         // Implementacao escolhida para a CPU
+    static const char* searchName;
+    
+    static SearchFunction selectSearch();
+
+public:
+    // Ate este numero de frames a busca SIMD compensa: sem insercoes e
+    // remocoes no hash, os page faults ficam mais baratos (medido com o
+    // benchmark; acima disso o indice em hash vence)
+    static const int LINEAR_SEARCH_LIMIT = 256;
+    
+    explicit FrameStore(int size);
+    
+    // Indice do frame que contem a pagina, ou -1
+    int find(int page) const {
+        int offset = 0;
+        while (offset < frameCount) {
+            int index = search(pages.data() + offset, frameCount - offset, page);
+            if (index < 0) {
+                return -1;
+            }
+            index += offset;
+            if (isValid(index)) {
+                return index;
+            }
+            offset = index + 1;   // Coincidiu com um frame vazio (-1)
+        }
+        return -1;
+    }
+    
+    int getPage(int index) const { return pages[index]; }
+    bool isValid(int index) const { return (validBits[index >> 6] >> (index & 63)) & 1; }
+    bool getReferenceBit(int index) const { return (referenceBits[index >> 6] >> (index & 63)) & 1; }
+    
+    void setReferenceBit(int index) { referenceBits[index >> 6] |= 1ULL << (index & 63); }
+    void clearReferenceBit(int index) { referenceBits[index >> 6] &= ~(1ULL << (index & 63)); }
+    
+    // Ocupa o frame com a pagina e bit de referencia ligado
+    void load(int index, int page) {
+        pages[index] = page;
+        validBits[index >> 6] |= 1ULL << (index & 63);
+        setReferenceBit(index);
+    }
+    
+    // Esvazia o frame (frames so esvaziam no reset ou ao encolher a memoria)
+    void unload(int index) {
+        pages[index] = -1;
+        validBits[index >> 6] &= ~(1ULL << (index & 63));
+        clearReferenceBit(index);
+    }
+    
+    // Novos frames entram vazios; ao encolher, os frames do fim sao descartados
+    void resize(int size);
+    
+    // Ponteiro do relogio: a partir de start (circular), limpa os bits de
+    // referencia ligados e retorna o primeiro frame com bit desligado
+    int sweepReferenceBits(int start);
+    
+    void clear();
+    int size() const { return frameCount; }
+    PackedFrame at(int index) const;
+    
+    // Bytes ocupados por frame: pagina (4) + bits de referencia e validade
+    static double getBytesPerFrame() { return sizeof(int) + 2.0 / 8.0; }
+    
+    // Nome da implementacao de busca em uso ("avx2", "sse2" ou "scalar")
+    static const char* getSearchName();
+};
+
+#endif // FRAME_STORE_H
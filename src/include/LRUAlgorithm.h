@@ -0,0 +1,55 @@
+#ifndef LRU_ALGORITHM_H
+#define LRU_ALGORITHM_H
+
+#include "PageReplacementAlgorithm.h"
+#include "PageIndex.h"
+#include <vector>
+
+/**
+ * @brief LRU exato (Least Recently Used)
+ *
+ * Os frames formam uma lista duplamente encadeada intrusiva (indices
+ * prev/next no proprio frame, sem alocacao por referencia), da pagina
+ * usada mais recentemente (head) a menos recente (tail). O indice
+ * pagina -> frame e um PageIndex. Hit move o frame para o inicio; fault
+ * reaproveita o frame do fim: tudo em O(1), qualquer que seja a memoria.
+ * Serve de referencia para medir quanto o Clock se afasta do LRU.
+ */
+class LRUAlgorithm : public PageReplacementAlgorithm {
+private:
+    static const int NONE = -1;
+    
+    struct Frame {
+        int page;
+        int prev;    // Frame usado logo depois (mais recente) ou NONE
+        int next;    // Frame usado logo antes (menos recente) ou NONE
+    };
+    
+    std::vector<Frame> frames;
+    int head;                    // Mais recente
+    int tail;                    // Menos recente (proxima vitima)
+    int loadedFrames;            // Frames ja ocupados (os vazios sao o sufixo)
+    PageIndex<int> pageTable;    // Indice pagina -> frame
+    
+    void unlink(int frame);
+    void pushFront(int frame);
+    bool touchPage(int pageNumber);
+    void displayMemoryState() const;
+
+public:
+    explicit LRUAlgorithm(int size, bool debug = false);
+    ~LRUAlgorithm() override = default;
+    
+    // Implementacao dos metodos virtuais
+    bool referencePage(int pageNumber) override;
+    const AlgorithmStatistics& referencePages(const int* pages, size_t n,
+                                              uint8_t* outHitMask = nullptr) override;
+    void displayMemory() const override;
+    void reset() override;
+    std::string getAlgorithmName() const override { return "LRU (Lista de Recencia)"; }
+    
+    // Paginas da mais recente para a menos recente
+    std::vector<int> getCurrentPages() const;
+};
+
+#endif // LRU_ALGORITHM_H
@@ -0,0 +1,116 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Nivel de severidade do log (em ordem crescente)
+ */
+enum class LogLevel : uint8_t {
+    TRACE,      // Cada referencia (hit/fault, segunda chance)
+    DEBUG,      // Substituicoes de pagina
+    INFO,
+    WARN,       // Referencias invalidas
+    ERROR,
+    OFF
+};
+
+/**
+ * @brief Tipo de evento estruturado
+ */
+enum class LogEventType : uint8_t {
+    PAGE_HIT,
+    PAGE_FAULT,
+    PAGE_EVICTED,
+    SECOND_CHANCE,
+    INVALID_PAGE
+};
+
+/**
+ * @brief Evento de log de tamanho fixo (sem alocacao no produtor)
+ * 
+ * 'source' deve apontar para uma string de duracao estatica, pois o
+ * evento e formatado depois, na thread do logger.
+ */
+struct LogEvent {
+    uint64_t step;            // Numero da referencia no algoritmo
+    const char* source;       // Quem gerou o evento (ex.: "clock")
+    int64_t page;
+    int frame;                // Frame/slot envolvido (-1 se nao se aplica)
+    int64_t evictedPage;      // Pagina substituida (-1 se nao se aplica)
+    LogEventType type;
+    LogLevel level;
+};
+
+/**
+ * @brief Logger assincrono com niveis e eventos estruturados
+ *
+ * Os produtores (algoritmos, possivelmente em varias threads) apenas
+ * copiam o evento para uma fila circular lock-free de capacidade fixa;
+ * a formatacao e a escrita acontecem numa thread de fundo. Com o log
+ * desligado, cada ponto de log custa um desvio previsivel. Compilando
+ * com -DPAGESIM_DISABLE_LOGGING os pontos de log somem do codigo.
+ */
+class Logger {
+private:
+    static std::atomic<uint8_t> threshold;   // Menor nivel emitido (OFF = desligado)
+    
+    static void push(const LogEvent& event);
+
+public:
+    static const size_t QUEUE_CAPACITY = 1 << 16;
+    
+    // Inicia a thread do logger; caminho vazio escreve em stderr
+    static void start(LogLevel level, const std::string& path = "");
+    // Esvazia a fila e encerra a thread
+    static void stop();
+    // Bloqueia ate que todos os eventos ja registrados tenham sido escritos
+    static void flush();
+
+#ifdef PAGESIM_DISABLE_LOGGING
+    static bool isEnabled(LogLevel) { return false; }
+#else
+    static bool isEnabled(LogLevel level) {
+        return static_cast<uint8_t>(level) >= threshold.load(std::memory_order_relaxed);
+    }
+#endif
+
+    static void log(LogLevel level, LogEventType type, const char* source, uint64_t step,
+                    int64_t page, int frame = -1, int64_t evictedPage = -1) {
+        if (isEnabled(level)) {
+            LogEvent event = {step, source, page, frame, evictedPage, type, level};
+            push(event);
+        }
+    }
+    
+    static bool parseLevel(const std::string& name, LogLevel& level);
+    static std::string getLevelName(LogLevel level);
+};
+
+/**
+ * @brief Mantem o logger ativo durante um escopo (para em caso de excecao)
+ */
+class ScopedLogger {
+private:
+    bool active;
+
+public:
+    ScopedLogger(LogLevel level, const std::string& path = "") : active(level != LogLevel::OFF) {
+        if (active) {
+            Logger::start(level, path);
+        }
+    }
+    ~ScopedLogger() {
+        if (active) {
+            Logger::stop();
+        }
+    }
+    
+    ScopedLogger(const ScopedLogger&) = delete;
+    ScopedLogger& operator=(const ScopedLogger&) = delete;
+};
+
+#endif // LOGGER_H
@@ -4,37 +4,39 @@
 #include "PageReplacementAlgorithm.h"
 #include "ClockAlgorithm.h"
 #include "SecondChanceAlgorithm.h"
+#include "LRUAlgorithm.h"
+#include "AgingAlgorithm.h"
+#include "ARCAlgorithm.h"
+#include "CARAlgorithm.h"
+#include "TraceStream.h"
+#include "ReferenceHistory.h"
+#include "TraceReplay.h"
+#include "SparsePageMap.h"
 #include <vector>
 #include <string>
 #include <memory>
+#include <set>
+#include <unordered_set>
 
 /**
  * @brief Tipo de algoritmo de substituicao de pagina
  */
 enum class AlgorithmType {
     CLOCK,          // Algoritmo Clock (buffer circular)
-    SECOND_CHANCE   // Algoritmo Segunda Chance (lista linear)
+    SECOND_CHANCE,  // Algoritmo Segunda Chance (lista linear)
+    LRU,            // LRU exato (lista de recencia)
+    AGING,          // Aging (NFU com contadores deslocados)
+    ARC,            // Adaptive Replacement Cache
+    CAR             // Clock with Adaptive Replacement
 };
 
 /**
- * @brief Tipo de resultado de uma operacao de referencia
+ * @brief Algoritmo disponivel no menu (tabela ALGORITHMS em MemoryManager.cpp)
  */
-enum class ReferenceResult {
-    HIT,        // Pagina encontrada na memoria
-    MISS,       // Page fault - pagina nao encontrada
-    INVALID     // Referencia invalida
-};
-
-/**
- * @brief Informacoes sobre uma referencia de pagina
- */
-struct ReferenceInfo {
-    int pageNumber;
-    ReferenceResult result;
-    std::string description;
-    
-    ReferenceInfo(int page, ReferenceResult res, const std::string& desc = "")
-        : pageNumber(page), result(res), description(desc) {}
+struct AlgorithmInfo {
+    AlgorithmType type;
+    ReplayPolicy policy;      // Politica criada pelo PolicyFactory
+    const char* displayName;
 };
 
 /**
@@ -42,20 +44,34 @@ struct ReferenceInfo {
  */
 class MemoryManager {
 private:
-    std::unique_ptr<ClockAlgorithm> clockAlgorithm;
-    std::unique_ptr<SecondChanceAlgorithm> secondChanceAlgorithm;
-    std::vector<ReferenceInfo> referenceHistory;
-    int virtualMemorySize;    // Numero maximo de paginas validas
+    std::vector<std::unique_ptr<PageReplacementAlgorithm>> algorithms;  // Um por AlgorithmType
+    PageReplacementAlgorithm* activeAlgorithm;  // Algoritmo em uso (sem if/else por referencia)
+    ReferenceHistory referenceHistory;  // Ultimas referencias (buffer circular)
+    uint64_t referenceStep;             // Referencias processadas desde o reset
+    int64_t virtualMemorySize;  // Paginas validas 0..N-1 (0 = espaco esparso de 64 bits)
+    bool sparse;                // IDs passam pelo pageMap antes dos algoritmos
+    SparsePageMap pageMap;      // ID de 64 bits -> ID denso (se sparse)
     bool loggingEnabled;      // Log de operacoes habilitado
     AlgorithmType currentAlgorithm;  // Algoritmo atualmente em uso
 
     // Metodos de validacao
-    bool isValidPageNumber(int pageNumber) const;
+    bool isValidPageNumber(int64_t pageNumber) const;
     std::string getResultString(ReferenceResult result) const;
+    void updateActiveAlgorithm();
+    void recordReference(int64_t pageNumber, ReferenceResult result, int64_t evictedPage = -1);
+    
+    // Traducao entre IDs de pagina e IDs usados pelos algoritmos
+    int toInternalPage(int64_t pageNumber) { return sparse ? pageMap.intern(pageNumber) : static_cast<int>(pageNumber); }
+    int64_t toPageId(int internalPage) const;
+    const int* toInternalPages(const int* pages, size_t n, std::vector<int>& buffer);
+    const int* toInternalPages(const int64_t* pages, size_t n, std::vector<int>& buffer);
+    
+    template <typename Page> void processBatch(const Page* pages, size_t n);
+    template <typename Page> void processPages(const Page* pages, size_t length);
 
 public:
-    // Construtor
-    MemoryManager(int physicalMemorySize, int virtualMemorySize = 100, 
+    // Construtor (virtualMemorySize 0 = espaco esparso de 64 bits)
+    MemoryManager(int physicalMemorySize, int64_t virtualMemorySize = 100, 
                   bool debug = false, bool logging = true, 
                   AlgorithmType algorithm = AlgorithmType::CLOCK);
     
@@ -63,20 +79,25 @@ public:
     ~MemoryManager() = default;
 
     // Metodos principais de gerenciamento
-    ReferenceResult processPageReference(int pageNumber);
+    ReferenceResult processPageReference(int64_t pageNumber);
     void processSequence(const std::vector<int>& pageSequence);
+    void processSequence(const std::vector<int64_t>& pageSequence);
+    void processSequence(const int* pages, size_t length);
+    void processStream(TraceStream& stream);
     
     // Metodos de configuracao
-    void setVirtualMemorySize(int size);
+    void setVirtualMemorySize(int64_t size);
     void enableLogging(bool enable) { loggingEnabled = enable; }
     void enableDebug(bool enable);
+    void setHistoryCapacity(size_t capacity);  // 0 desabilita o historico
     void setAlgorithm(AlgorithmType algorithm);
     
     // Metodos de consulta
     const AlgorithmStatistics& getStatistics() const;
-    const std::vector<ReferenceInfo>& getHistory() const { return referenceHistory; }
+    const ReferenceHistory& getHistory() const { return referenceHistory; }
     int getPhysicalMemorySize() const;
-    int getVirtualMemorySize() const { return virtualMemorySize; }
+    int64_t getVirtualMemorySize() const { return virtualMemorySize; }
+    bool isSparse() const { return sparse; }
     AlgorithmType getCurrentAlgorithm() const { return currentAlgorithm; }
     std::string getCurrentAlgorithmName() const;
     
@@ -89,6 +110,11 @@ public:
     void compareWithFIFO(const std::vector<int>& sequence) const;
     void compareWithOptimal(const std::vector<int>& sequence) const;
     void compareClockWithSecondChance(const std::vector<int>& sequence) const;
+    void compareClockWithLRU(const std::vector<int>& sequence) const;
+    
+    // Algoritmos do menu, na ordem de AlgorithmType
+    static const std::vector<AlgorithmInfo>& getAlgorithms();
+    static const AlgorithmInfo& getAlgorithmInfo(AlgorithmType type);
     
     // Utilitarios
     void reset();
@@ -104,28 +130,45 @@ public:
 class FIFOSimulator {
 private:
     std::vector<int> frames;
+    std::unordered_set<int> resident;   // Paginas em memoria (busca em O(1))
     int nextFrame;
     int memorySize;
 
 public:
     explicit FIFOSimulator(int size);
-    int simulate(const std::vector<int>& sequence);
+    uint64_t simulate(const std::vector<int>& sequence);
+    uint64_t simulate(const int* sequence, size_t length);
+    
+    // Processamento incremental (bloco a bloco), sem reiniciar a memoria
+    void reset();
+    uint64_t process(const int* sequence, size_t length);
 };
 
 /**
  * @brief Simulador de algoritmo otimo (Belady) para comparacao
+ * 
+ * Uma passagem de tras para frente calcula o proximo uso de cada
+ * referencia; as paginas residentes ficam ordenadas por proximo uso,
+ * de modo que a vitima (uso mais distante) sai em O(log k).
  */
 class OptimalSimulator {
 private:
     int memorySize;
+    std::vector<int> nextUse;                  // Proximo uso de cada referencia do trace
+    std::set<std::pair<int, int>> resident;    // (proximo uso, pagina)
+    int position;                              // Referencias ja processadas
     
-    int findOptimalVictim(const std::vector<int>& frames, 
-                         const std::vector<int>& sequence, 
-                         int currentIndex) const;
+    std::vector<int> computeNextUse(const int* sequence, size_t length) const;
 
 public:
-    explicit OptimalSimulator(int size) : memorySize(size) {}
-    int simulate(const std::vector<int>& sequence);
+    explicit OptimalSimulator(int size) : memorySize(size), position(0) {}
+    uint64_t simulate(const std::vector<int>& sequence);
+    uint64_t simulate(const int* sequence, size_t length);
+    
+    // Processamento incremental: prepare recebe o trace inteiro (o
+    // proximo uso depende do futuro); process consome os blocos em ordem
+    void prepare(const int* sequence, size_t length);
+    uint64_t process(const int* sequence, size_t length);
 };
 
 #endif // MEMORY_MANAGER_H
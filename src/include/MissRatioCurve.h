@@ -0,0 +1,53 @@
+#ifndef MISS_RATIO_CURVE_H
+#define MISS_RATIO_CURVE_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Arvore de Fenwick (BIT) para somas de prefixo em O(log n)
+ */
+class FenwickTree {
+private:
+    std::vector<int> tree;
+
+public:
+    explicit FenwickTree(size_t size) : tree(size + 1, 0) {}
+    
+    void add(size_t index, int delta);
+    int prefixSum(size_t index) const;    // Soma de [0, index]
+    int rangeSum(size_t from, size_t to) const;
+};
+
+/**
+ * @brief Curva de page faults x frames em uma unica passagem (Mattson)
+ * 
+ * Para algoritmos de pilha (LRU e OPT), uma pagina referenciada a
+ * distancia de pilha d gera page fault em toda memoria com menos de d
+ * frames. Um histograma de distancias fornece, de uma vez, os page
+ * faults para 1..maxFrames frames, sem re-simular cada tamanho.
+ */
+class MissRatioCurve {
+private:
+    int maxFrames;
+    
+    std::vector<uint64_t> buildCurve(const std::vector<uint64_t>& histogram,
+                                     uint64_t beyond) const;
+
+public:
+    explicit MissRatioCurve(int maxFrames);
+    
+    // faults[c - 1] = page faults com c frames, para c = 1..maxFrames
+    
+    // LRU: distancias de pilha via Fenwick sobre os tempos de acesso, O(n log n)
+    std::vector<uint64_t> computeLRU(const int* sequence, size_t length) const;
+    
+    // OPT: pilha de prioridade por proximo uso (Mattson/Belady) limitada a
+    // maxFrames posicoes, O(n * maxFrames)
+    std::vector<uint64_t> computeOptimal(const int* sequence, size_t length) const;
+    
+    int getMaxFrames() const { return maxFrames; }
+};
+
+#endif // MISS_RATIO_CURVE_H
@@ -0,0 +1,161 @@
+#ifndef PAGE_INDEX_H
+#define PAGE_INDEX_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Indice pagina -> valor com enderecamento aberto
+ *
+ * Tabela de hash com sondagem linear sobre dois vetores contiguos
+ * (chaves e valores), capacidade potencia de 2 e ocupacao maxima de 3/4.
+ * Valor negativo marca slot livre. A remocao desloca para tras as
+ * entradas seguintes do mesmo cluster, sem lapides, entao as buscas
+ * continuam curtas apos muitas substituicoes. Cada slot ocupa
+ * sizeof(Key) + 4 bytes, contra ~40 bytes por no de std::unordered_map.
+ */
+template <typename Key>
+class PageIndex {
+private:
+    std::vector<Key> keys;
+    std::vector<int> values;    // -1 = slot livre
+    size_t mask;                // Capacidade - 1
+    size_t count;
+    int shift;                  // 64 - log2(capacidade)
+    
+    static const size_t MIN_CAPACITY = 8;
+    
+    // Hash multiplicativo (Fibonacci): usa os bits altos do produto
+    size_t home(Key key) const {
+        return static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+    
+    void rehash(size_t capacity) {
+        std::vector<Key> oldKeys;
+        std::vector<int> oldValues;
+        oldKeys.swap(keys);
+        oldValues.swap(values);
+        
+        keys.assign(capacity, Key());
+        values.assign(capacity, -1);
+        mask = capacity - 1;
+        shift = 64;
+        for (size_t c = capacity; c > 1; c >>= 1) {
+            --shift;
+        }
+        
+        for (size_t i = 0; i < oldValues.size(); ++i) {
+            if (oldValues[i] >= 0) {
+                size_t slot = home(oldKeys[i]);
+                while (values[slot] >= 0) {
+                    slot = (slot + 1) & mask;
+                }
+                keys[slot] = oldKeys[i];
+                values[slot] = oldValues[i];
+            }
+        }
+    }
+    
+    // Slot da chave ou, se ausente, o slot livre onde ela entraria
+    size_t probe(Key key) const {
+        size_t slot = home(key);
+        while (values[slot] >= 0 && keys[slot] != key) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+    
+    // Garante espaco para mais uma entrada
+    void reserveOne() {
+        if (count + 1 > (mask + 1) / 4 * 3) {
+            rehash((mask + 1) * 2);
+        }
+    }
+    
+    // Menor potencia de 2 que comporta 'expected' entradas com ocupacao <= 3/4
+    static size_t capacityFor(size_t expected) {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity / 4 * 3 < expected) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+public:
+    explicit PageIndex(size_t expected = 0) : mask(0), count(0), shift(64) {
+        rehash(capacityFor(expected));
+    }
+    
+    // Valor associado a chave, ou -1
+    int find(Key key) const {
+        return values[probe(key)];
+    }
+    
+    // Insere (ou atualiza) a chave com valor >= 0
+    void insert(Key key, int value) {
+        reserveOne();
+        size_t slot = probe(key);
+        if (values[slot] < 0) {
+            keys[slot] = key;
+            ++count;
+        }
+        values[slot] = value;
+    }
+    
+    // Retorna o valor ja associado a chave; se nao houver, associa 'value'
+    int insertIfAbsent(Key key, int value) {
+        reserveOne();
+        size_t slot = probe(key);
+        if (values[slot] >= 0) {
+            return values[slot];
+        }
+        keys[slot] = key;
+        values[slot] = value;
+        ++count;
+        return value;
+    }
+    
+    // Remove a chave; retorna false se ela nao existia
+    bool erase(Key key) {
+        size_t hole = probe(key);
+        if (values[hole] < 0) {
+            return false;
+        }
+        
+        // Puxa para o buraco as entradas cujo slot de origem nao esta
+        // entre o buraco e a posicao atual (circular)
+        size_t next = (hole + 1) & mask;
+        while (values[next] >= 0) {
+            size_t origin = home(keys[next]);
+            if (((next - origin) & mask) >= ((next - hole) & mask)) {
+                keys[hole] = keys[next];
+                values[hole] = values[next];
+                hole = next;
+            }
+            next = (next + 1) & mask;
+        }
+        
+        values[hole] = -1;
+        --count;
+        return true;
+    }
+    
+    void clear() {
+        values.assign(values.size(), -1);
+        count = 0;
+    }
+    
+    void reserve(size_t expected) {
+        size_t capacity = capacityFor(expected);
+        if (capacity > mask + 1) {
+            rehash(capacity);
+        }
+    }
+    
+    size_t size() const { return count; }
+    size_t getCapacity() const { return mask + 1; }
+    size_t getBytes() const { return (mask + 1) * (sizeof(Key) + sizeof(int)); }
+};
+
+#endif // PAGE_INDEX_H
@@ -4,14 +4,19 @@
 #include <vector>
 #include <iostream>
 #include <iomanip>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
 
 /**
  * @brief Estrutura para estatisticas dos algoritmos
+ *
+ * Contadores de 64 bits: traces longos passam de 2^31 referencias.
  */
 struct AlgorithmStatistics {
-    int totalReferences;
-    int pageFaults;
-    int hits;
+    uint64_t totalReferences;
+    uint64_t pageFaults;
+    uint64_t hits;
     
     AlgorithmStatistics() : totalReferences(0), pageFaults(0), hits(0) {}
     
@@ -38,10 +43,11 @@ protected:
     int memorySize;
     AlgorithmStatistics stats;
     bool debugMode;
+    int lastEvictedPage;    // Pagina substituida na ultima referencia (-1 se nenhuma)
 
 public:
     explicit PageReplacementAlgorithm(int size, bool debug = false)
-        : memorySize(size), debugMode(debug) {}
+        : memorySize(size), debugMode(debug), lastEvictedPage(-1) {}
     
     virtual ~PageReplacementAlgorithm() = default;
     
@@ -51,9 +57,70 @@ public:
     virtual void reset() = 0;
     virtual std::string getAlgorithmName() const = 0;
     
+    /**
+     * @brief Processa um lote de referencias com uma unica chamada virtual
+     * @param pages Paginas referenciadas
+     * @param n Numero de referencias
+     * @param outHitMask Opcional: (n + 7) / 8 bytes; bit (i % 8) do byte
+     *        i / 8 recebe 1 se a referencia i foi hit e 0 se foi page fault
+     * @return Estatisticas atualizadas
+     * 
+     * A implementacao padrao chama referencePage para cada pagina; os
+     * algoritmos sobrescrevem com um laco proprio, sem despacho virtual.
+     */
+    virtual const AlgorithmStatistics& referencePages(const int* pages, size_t n,
+                                                      uint8_t* outHitMask = nullptr) {
+        if (outHitMask) {
+            std::fill(outHitMask, outHitMask + (n + 7) / 8, 0);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            if (!referencePage(pages[i]) && outHitMask) {
+                outHitMask[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+            }
+        }
+        return stats;
+    }
+
+protected:
+    /**
+     * @brief Laco de lote comum aos algoritmos sem despacho virtual
+     * @param touch Referencia uma pagina (retorna true se page fault)
+     * 
+     * Em modo debug cai na implementacao padrao (que imprime cada passo);
+     * fora dele chama touch para cada pagina e, com mascara, grava os bits
+     * de hit de 8 em 8 referencias no formato descrito em referencePages.
+     */
+    template <typename Touch>
+    const AlgorithmStatistics& replayBatch(const int* pages, size_t n,
+                                           uint8_t* outHitMask, Touch touch) {
+        if (debugMode) {
+            return PageReplacementAlgorithm::referencePages(pages, n, outHitMask);
+        }
+        
+        if (!outHitMask) {
+            for (size_t i = 0; i < n; ++i) {
+                touch(pages[i]);
+            }
+            return stats;
+        }
+        
+        for (size_t i = 0; i < n; i += 8) {
+            size_t end = std::min(n, i + 8);
+            uint8_t bits = 0;
+            for (size_t j = i; j < end; ++j) {
+                bits |= static_cast<uint8_t>(!touch(pages[j])) << (j - i);
+            }
+            outHitMask[i >> 3] = bits;
+        }
+        
+        return stats;
+    }
+
+public:
     // Metodos comuns
     const AlgorithmStatistics& getStatistics() const { return stats; }
     int getMemorySize() const { return memorySize; }
+    int getLastEvictedPage() const { return lastEvictedPage; }
     void setDebugMode(bool debug) { debugMode = debug; }
     
     virtual void displayStatistics() const {
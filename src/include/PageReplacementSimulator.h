@@ -23,7 +23,7 @@ private:
     void showStatistics();
     
     // Métodos utilitários
-    std::vector<int> parseSequence(const std::string& input);
+    std::vector<int64_t> parseSequence(const std::string& input);
     void updateMemoryManager();
 
 public:
@@ -0,0 +1,83 @@
+#ifndef REFERENCE_HISTORY_H
+#define REFERENCE_HISTORY_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Tipo de resultado de uma operacao de referencia
+ */
+enum class ReferenceResult : uint8_t {
+    HIT,        // Pagina encontrada na memoria
+    MISS,       // Page fault - pagina nao encontrada
+    INVALID     // Referencia invalida
+};
+
+/**
+ * @brief Registro compacto de uma referencia (24 bytes)
+ * 
+ * O passo e o resultado dividem a mesma palavra de 64 bits; a descricao
+ * textual so e montada quando o historico e exibido. As paginas guardam
+ * o ID original, de ate 64 bits.
+ */
+struct ReferenceRecord {
+    uint64_t stepAndResult;   // Bits 0..61 = passo (1, 2, ...), bits 62..63 = resultado
+    int64_t pageNumber;
+    int64_t evictedPage;      // Pagina substituida (-1 se nenhuma)
+    
+    ReferenceRecord() : stepAndResult(0), pageNumber(-1), evictedPage(-1) {}
+    ReferenceRecord(uint64_t step, int64_t page, ReferenceResult result, int64_t evicted)
+        : stepAndResult((step & STEP_MASK) | (static_cast<uint64_t>(result) << 62)),
+          pageNumber(page), evictedPage(evicted) {}
+    
+    uint64_t getStep() const { return stepAndResult & STEP_MASK; }
+    ReferenceResult getResult() const { return static_cast<ReferenceResult>(stepAndResult >> 62); }
+    std::string describe() const;
+    
+    static const uint64_t STEP_MASK = (1ULL << 62) - 1;
+};
+
+/**
+ * @brief Historico de referencias em buffer circular de capacidade fixa
+ * 
+ * Guarda apenas as ultimas 'capacity' referencias, com memoria constante.
+ * Com capacidade 0 o historico fica desabilitado e record() nao e chamado
+ * pelo MemoryManager.
+ */
+class ReferenceHistory {
+private:
+    std::vector<ReferenceRecord> records;
+    size_t capacity;
+    size_t head;          // Posicao do registro mais antigo
+    size_t count;
+
+public:
+    static const size_t DEFAULT_CAPACITY = 4096;
+    
+    explicit ReferenceHistory(size_t capacity = DEFAULT_CAPACITY);
+    
+    void record(const ReferenceRecord& entry) {
+        if (count < capacity) {
+            records[(head + count++) % capacity] = entry;
+        } else {
+            records[head] = entry;
+            head = (head + 1) % capacity;
+        }
+    }
+    
+    void setCapacity(size_t newCapacity);
+    void clear() { head = 0; count = 0; }
+    
+    bool isEnabled() const { return capacity > 0; }
+    size_t size() const { return count; }
+    size_t getCapacity() const { return capacity; }
+    
+    // Indice 0 = registro mais antigo ainda guardado
+    const ReferenceRecord& operator[](size_t index) const {
+        return records[(head + index) % capacity];
+    }
+};
+
+#endif // REFERENCE_HISTORY_H
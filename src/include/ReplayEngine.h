@@ -0,0 +1,133 @@
+#ifndef REPLAY_ENGINE_H
+#define REPLAY_ENGINE_H
+
+#include "TraceReplay.h"
+#include "AdaptiveDirectory.h"
+#include <vector>
+#include <memory>
+#include <functional>
+#include <stdexcept>
+
+/**
+ * @brief Politica que consome o trace bloco a bloco
+ *
+ * Interface comum aos algoritmos da hierarquia PageReplacementAlgorithm
+ * e aos simuladores de comparacao (FIFO e Otimo), usada pelo ReplayEngine.
+ */
+class PolicySimulator {
+public:
+    virtual ~PolicySimulator() = default;
+    
+    // Chamado uma vez com o trace inteiro, antes dos blocos (so o Otimo usa)
+    virtual void prepare(const int* pages, size_t count) { (void)pages; (void)count; }
+    virtual void process(const int* pages, size_t count) = 0;
+    // Como process, ligando em hitMask o bit i se a referencia i foi hit.
+    // Padrao: uma referencia por vez, pela variacao dos page faults
+    virtual void processWithHits(const int* pages, size_t count, uint8_t* hitMask);
+    virtual const AlgorithmStatistics& getStatistics() const = 0;
+    
+    // Politicas que precisam de prepare nao funcionam em streaming
+    virtual bool needsFullTrace() const { return false; }
+    
+    // Alvo p ao longo do replay (so ARC e CAR; as demais retornam nullptr)
+    virtual const TargetHistory* getTargetHistory() const { return nullptr; }
+};
+
+/**
+ * @brief Cria politicas a partir do ReplayPolicy
+ */
+class PolicyFactory {
+public:
+    static std::unique_ptr<PolicySimulator> create(ReplayPolicy policy, int frames);
+    
+    // Algoritmo com display e debug (todos menos FIFO e OPTIMAL)
+    static std::unique_ptr<PageReplacementAlgorithm> createAlgorithm(ReplayPolicy policy,
+                                                                      int frames, bool debug);
+};
+
+/**
+ * @brief Executa varias politicas em uma unica passagem pelo trace
+ *
+ * O trace e lido uma vez e dividido em blocos pequenos; cada bloco e
+ * entregue a todas as politicas registradas antes do proximo, enquanto
+ * ainda esta no cache. Comparar N politicas (ou N tamanhos de memoria)
+ * custa uma leitura do trace em vez de N. O tempo de cada politica e
+ * medido bloco a bloco.
+ *
+ * Com um BlockObserver, cada politica preenche tambem a mascara de hits
+ * do bloco, entregue ao observador antes do proximo bloco: comparacoes
+ * referencia a referencia (ex.: em quantas o Clock discorda do LRU) sem
+ * guardar o resultado do trace inteiro.
+ */
+class ReplayEngine {
+public:
+    // Chamado apos cada bloco; hitMasks[i] e a mascara da politica i
+    // (bit j = referencia j do bloco foi hit)
+    typedef std::function<void(size_t count, const std::vector<const uint8_t*>& hitMasks)> BlockObserver;
+
+private:
+    struct Entry {
+        ReplayPolicy policy;
+        int frames;
+        std::unique_ptr<PolicySimulator> simulator;
+        double seconds;
+        std::vector<uint8_t> hitMask;     // Mascara do bloco atual (so com observador)
+    };
+    
+    std::vector<Entry> entries;
+    size_t blockSize;
+    BlockObserver observer;
+    
+    void processBlocks(const int* pages, size_t count);
+
+public:
+    // 4096 paginas = 16 KB: o bloco fica no L1 enquanto as politicas o leem
+    static const size_t DEFAULT_BLOCK_SIZE = 4096;
+    
+    explicit ReplayEngine(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    
+    ReplayEngine(const ReplayEngine&) = delete;
+    ReplayEngine& operator=(const ReplayEngine&) = delete;
+    
+    // Registra uma politica; retorna seu indice nos resultados
+    size_t addPolicy(ReplayPolicy policy, int frames);
+    
+    // Passa a calcular as mascaras de hits e entrega-las a cada bloco
+    void setBlockObserver(BlockObserver blockObserver);
+    
+    // Trace completo na memoria (todas as politicas, inclusive o Otimo)
+    void run(const int* pages, size_t count);
+    void run(const std::vector<int>& pages) { run(pages.data(), pages.size()); }
+    
+    // Fonte de blocos com nextChunk(const int*&, size_t&) (TraceStream,
+    // WorkloadGenerator); nao aceita politicas que precisam do trace inteiro
+    template <typename ChunkSource>
+    void runChunks(ChunkSource& source);
+    
+    bool supportsStreaming() const;
+    size_t size() const { return entries.size(); }
+    ReplayPolicy getPolicy(size_t index) const { return entries[index].policy; }
+    int getFrames(size_t index) const { return entries[index].frames; }
+    const AlgorithmStatistics& getStatistics(size_t index) const {
+        return entries[index].simulator->getStatistics();
+    }
+    double getSeconds(size_t index) const { return entries[index].seconds; }
+    const TargetHistory* getTargetHistory(size_t index) const {
+        return entries[index].simulator->getTargetHistory();
+    }
+};
+
+template <typename ChunkSource>
+void ReplayEngine::runChunks(ChunkSource& source) {
+    if (!supportsStreaming()) {
+        throw std::invalid_argument("Algoritmo otimo precisa do trace completo (sem streaming)");
+    }
+    
+    const int* pages;
+    size_t count;
+    while (source.nextChunk(pages, count)) {
+        processBlocks(pages, count);
+    }
+}
+
+#endif // REPLAY_ENGINE_H
@@ -2,35 +2,37 @@
 #define SECOND_CHANCE_ALGORITHM_H
 
 #include "PageReplacementAlgorithm.h"
+#include "FrameStore.h"
+#include "PageIndex.h"
 #include <vector>
 #include <queue>
 
-/**
- * @brief Estrutura que representa uma pagina na memoria
- */
-struct SecondChancePage {
-    int pageNumber;      // Numero da pagina
-    bool referenceBit;   // Bit de referencia
-    
-    SecondChancePage() : pageNumber(-1), referenceBit(false) {}
-    SecondChancePage(int page) : pageNumber(page), referenceBit(true) {}
-};
-
 /**
  * @brief Implementacao do algoritmo Segunda Chance (Lista Linear)
  * 
- * O algoritmo Segunda Chance usa uma lista linear e move fisicamente 
- * as paginas quando dao uma "segunda chance", diferente do Clock que 
+ * O algoritmo Segunda Chance usa uma lista linear e move as paginas
+ * para o final quando dao uma "segunda chance", diferente do Clock que 
  * usa buffer circular com ponteiro fixo.
+ * 
+ * A lista e armazenada em uma fila circular de capacidade fixa: a posicao
+ * logica i corresponde ao slot (head + i) % memorySize. Mover o inicio da
+ * lista cheia para o final equivale a avancar head, portanto cada segunda
+ * chance custa O(1) em vez de um erase/push_back no vetor.
  */
 class SecondChanceAlgorithm : public PageReplacementAlgorithm {
 private:
-    std::vector<SecondChancePage> memory;  // Memoria fisica como lista
+    std::vector<PackedFrame> memory;       // Slots da fila circular (4 bytes cada)
+    int head;                              // Slot do inicio da lista
+    int count;                             // Paginas atualmente na lista
+    PageIndex<int> pageTable;       // Indice pagina -> slot
     
     // Metodos auxiliares
     int findPage(int pageNumber) const;
+    int slotAt(int position) const { return (head + position) % memorySize; }
+    int positionOf(int slot) const { return (slot - head + memorySize) % memorySize; }
     void moveToEnd(int index);
     void displayMemoryState() const;
+    bool touchPage(int pageNumber);
     
 public:
     SecondChanceAlgorithm(int size, bool debug = false);
@@ -38,6 +40,8 @@ public:
     
     // Implementacao dos metodos virtuais
     bool referencePage(int pageNumber) override;
+    const AlgorithmStatistics& referencePages(const int* pages, size_t n,
+                                              uint8_t* outHitMask = nullptr) override;
     void displayMemory() const override;
     void reset() override;
     std::string getAlgorithmName() const override { return "Segunda Chance (Lista Linear)"; }
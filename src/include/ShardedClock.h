@@ -0,0 +1,98 @@
+#ifndef SHARDED_CLOCK_H
+#define SHARDED_CLOCK_H
+
+#include "ClockAlgorithm.h"
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Parametros do Clock particionado
+ */
+struct ShardOptions {
+    int shards;              // Particoes, cada uma com seu ClockAlgorithm
+    int threadCount;         // Threads do replay (0 = numero de cores; no maximo shards)
+    size_t epochLength;      // Referencias entre rebalanceamentos (0 = cotas fixas)
+    int minFrames;           // Cota minima de um shard
+    
+    ShardOptions() : shards(4), threadCount(0), epochLength(65536), minFrames(1) {}
+};
+
+/**
+ * @brief Estado de um shard ao fim do replay
+ */
+struct ShardStatistics {
+    AlgorithmStatistics stats;
+    int frames;              // Cota final
+    int framesReceived;      // Frames recebidos de outros shards
+    int framesDonated;       // Frames cedidos a outros shards
+    
+    ShardStatistics() : frames(0), framesReceived(0), framesDonated(0) {}
+};
+
+/**
+ * @brief Clock particionado em shards, com migracao de cotas
+ *
+ * Os frames sao divididos entre shards independentes, cada um com seu
+ * proprio ClockAlgorithm (ponteiro, bits e indice), e cada pagina
+ * pertence sempre ao mesmo shard (hash multiplicativo). Sem estado
+ * compartilhado, cada thread do replay cuida dos seus shards sem
+ * sincronizacao e o ponteiro global deixa de ser um ponto de disputa.
+ *
+ * O trace e processado em epocas de epochLength referencias. Ao fim de
+ * cada uma (barreira), o shard com mais page faults na epoca recebe
+ * frames do shard com menos, se a diferenca passar de 1/8: a cota
+ * acompanha a pressao de faults sem oscilar com ruido. O resultado
+ * depende so do trace, de shards e de epochLength, nunca do numero de
+ * threads.
+ */
+class ShardedClock {
+private:
+    struct Shard {
+        std::unique_ptr<ClockAlgorithm> clock;
+        std::vector<int> pending;    // Referencias da epoca atual
+        uint64_t epochStart;         // Faults no inicio da epoca
+        int framesReceived;
+        int framesDonated;
+        char padding[64];            // pending de shards vizinhos (threads distintas) em linhas separadas
+    };
+    
+    int memorySize;
+    ShardOptions options;
+    std::vector<Shard> shards;
+    uint64_t migratedFrames;
+    
+    void rebalance();
+
+public:
+    ShardedClock(int frames, const ShardOptions& options);
+    
+    ShardedClock(const ShardedClock&) = delete;
+    ShardedClock& operator=(const ShardedClock&) = delete;
+    
+    // Shard dono da pagina. Mistura do murmur3, e nao o hash de Fibonacci:
+    // com ele as paginas de um shard ocupariam so parte do PageIndex
+    static int shardOf(int pageNumber, int shardCount) {
+        uint32_t hash = static_cast<uint32_t>(pageNumber);
+        hash ^= hash >> 16;
+        hash *= 0x85EBCA6Bu;
+        hash ^= hash >> 13;
+        hash *= 0xC2B2AE35u;
+        hash ^= hash >> 16;
+        return static_cast<int>((static_cast<uint64_t>(hash) * shardCount) >> 32);
+    }
+    
+    // Trace inteiro em epocas; retorna o tempo em segundos
+    double replay(const int* pages, size_t count);
+    
+    void reset();
+    
+    AlgorithmStatistics getStatistics() const;
+    ShardStatistics getShardStatistics(int shard) const;
+    int getShardCount() const { return static_cast<int>(shards.size()); }
+    int getMemorySize() const { return memorySize; }
+    uint64_t getMigratedFrames() const { return migratedFrames; }
+};
+
+#endif // SHARDED_CLOCK_H
@@ -0,0 +1,52 @@
+#ifndef SPARSE_PAGE_MAP_H
+#define SPARSE_PAGE_MAP_H
+
+#include "PageIndex.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Espaco de enderecamento esparso de 64 bits
+ *
+ * Traduz IDs de pagina de 64 bits (ex.: enderecos de 48 bits >> 12) para
+ * IDs densos 0, 1, 2, ... na ordem do primeiro acesso. Os algoritmos so
+ * comparam paginas por igualdade, entao trocar os rotulos nao muda nenhum
+ * resultado. A memoria cresce com as paginas tocadas (~20 bytes cada),
+ * nao com o tamanho do espaco.
+ */
+class SparsePageMap {
+private:
+    PageIndex<uint64_t> index;      // ID original -> ID denso
+    std::vector<int64_t> pageIds;   // ID denso -> ID original
+
+public:
+    SparsePageMap() = default;
+    
+    // ID denso da pagina, criado no primeiro acesso
+    int intern(int64_t page) {
+        int dense = index.insertIfAbsent(static_cast<uint64_t>(page),
+                                          static_cast<int>(pageIds.size()));
+        if (dense == static_cast<int>(pageIds.size())) {
+            addPage(page);
+        }
+        return dense;
+    }
+    
+    // ID denso ja atribuido, ou -1
+    int find(int64_t page) const { return index.find(static_cast<uint64_t>(page)); }
+    
+    int64_t getPageId(int dense) const { return pageIds[dense]; }
+    size_t size() const { return pageIds.size(); }
+    size_t getBytes() const { return index.getBytes() + pageIds.capacity() * sizeof(int64_t); }
+    
+    void clear();
+    
+    // Traduz um bloco inteiro (dense[i] = intern(pages[i]))
+    void internAll(const int64_t* pages, size_t count, int* dense);
+
+private:
+    void addPage(int64_t page);
+};
+
+#endif // SPARSE_PAGE_MAP_H
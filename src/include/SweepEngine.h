@@ -0,0 +1,61 @@
+#ifndef SWEEP_ENGINE_H
+#define SWEEP_ENGINE_H
+
+#include "TraceReplay.h"
+#include "AdaptiveDirectory.h"
+#include <vector>
+
+/**
+ * @brief Resultado de uma celula da varredura (algoritmo, frames)
+ */
+struct SweepResult {
+    ReplayPolicy policy;
+    int frames;
+    AlgorithmStatistics stats;
+    double wallSeconds;
+    std::vector<TargetSample> targetHistory;   // Alvo p ao longo do replay (so ARC e CAR)
+    
+    SweepResult() : policy(ReplayPolicy::CLOCK), frames(0), wallSeconds(0.0) {}
+};
+
+/**
+ * @brief Matriz de resultados: linhas = algoritmos, colunas = frames
+ */
+struct SweepMatrix {
+    std::vector<ReplayPolicy> policies;
+    std::vector<int> frameCounts;
+    std::vector<SweepResult> cells;   // Ordem row-major
+    double wallSeconds;               // Tempo total da varredura
+    
+    SweepMatrix() : wallSeconds(0.0) {}
+    
+    const SweepResult& at(size_t policyIndex, size_t frameIndex) const {
+        return cells[policyIndex * frameCounts.size() + frameIndex];
+    }
+};
+
+/**
+ * @brief Varredura paralela de parametros sobre um unico trace
+ * 
+ * As combinacoes (algoritmo, frames) sao agrupadas em tarefas de um
+ * WorkStealingPool; cada tarefa executa suas combinacoes em uma unica
+ * passagem pelo trace (ReplayEngine). Todas as tarefas leem a mesma copia
+ * do trace (somente leitura) e escrevem em celulas distintas da matriz,
+ * sem sincronizacao adicional.
+ */
+class SweepEngine {
+private:
+    int threadCount;
+
+public:
+    // threadCount <= 0 usa o numero de cores da maquina
+    explicit SweepEngine(int threadCount = 0);
+    
+    SweepMatrix run(const int* pages, size_t count,
+                    const std::vector<ReplayPolicy>& policies,
+                    const std::vector<int>& frameCounts) const;
+    
+    int getThreadCount() const { return threadCount; }
+};
+
+#endif // SWEEP_ENGINE_H
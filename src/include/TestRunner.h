@@ -22,6 +22,7 @@ private:
     void runTemporalLocalityTest();
     void runWorstCaseTest();
     void runComparisonTests();
+    void runClockLRUComparison();
     void runOptimalComparisonTests();
     
     // Métodos de display visual
@@ -33,9 +34,13 @@ private:
     void displayFinalSummary();
     void displayComparisonTable(const std::vector<std::string>& testNames,
                                const std::vector<std::vector<int>>& testSequences,
-                               const std::vector<int>& clockResults,
-                               const std::vector<int>& secondChanceResults,
-                               const std::vector<int>& optimalResults);
+                               const std::vector<uint64_t>& clockResults,
+                               const std::vector<uint64_t>& secondChanceResults,
+                               const std::vector<uint64_t>& optimalResults,
+                               const std::vector<uint64_t>& lruResults,
+                               const std::vector<uint64_t>& agingResults,
+                               const std::vector<uint64_t>& arcResults,
+                               const std::vector<uint64_t>& carResults);
 };
 
 #endif // TEST_RUNNER_H
@@ -0,0 +1,80 @@
+#ifndef TRACE_FILE_H
+#define TRACE_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Cabecalho do formato binario de trace (32 bytes, little-endian)
+ *
+ * Layout do arquivo:
+ *   [0..31]  TraceFileHeader
+ *   [32..]   referenceCount IDs de pagina com pageIdWidth bytes cada
+ *
+ * Os IDs ficam alinhados e podem ser usados diretamente da memoria
+ * mapeada, sem parsing nem copia. Com pageIdWidth = 8 os IDs sao de 64
+ * bits (espaco esparso) e passam pelo SparsePageMap antes do replay.
+ */
+struct TraceFileHeader {
+    char magic[8];            // "PGTRACE\0"
+    uint32_t version;         // Versao do formato (1)
+    uint32_t pageIdWidth;     // Bytes por ID de pagina (4 = int32, 8 = int64)
+    uint64_t referenceCount;  // Numero de referencias no arquivo
+    uint64_t reserved;        // Reservado (zero)
+};
+
+/**
+ * @brief Trace binario mapeado em memoria (somente leitura)
+ *
+ * O arquivo e mapeado com mmap (ou MapViewOfFile no Windows) e as
+ * paginas sao expostas como uma visao const int* (ou const int64_t*, se
+ * o trace tiver IDs de 64 bits) sobre o mapeamento.
+ */
+class MappedTrace {
+private:
+    void* mapping;            // Inicio do mapeamento
+    size_t mappingSize;       // Tamanho mapeado em bytes
+    const int* pages;         // Visao sobre os IDs de 32 bits (nullptr se largura 8)
+    const int64_t* widePages; // Visao sobre os IDs de 64 bits (nullptr se largura 4)
+    size_t referenceCount;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+
+public:
+    MappedTrace();
+    explicit MappedTrace(const std::string& path);
+    ~MappedTrace();
+    
+    MappedTrace(const MappedTrace&) = delete;
+    MappedTrace& operator=(const MappedTrace&) = delete;
+    
+    void open(const std::string& path);
+    void close();
+    
+    bool isOpen() const { return mapping != nullptr; }
+    const int* data() const { return pages; }
+    const int64_t* wideData() const { return widePages; }
+    bool isWide() const { return widePages != nullptr; }
+    size_t size() const { return referenceCount; }
+};
+
+/**
+ * @brief Utilitarios do formato binario de trace
+ */
+class TraceFile {
+public:
+    static const char kMagic[8];
+    static const uint32_t kVersion = 1;
+    
+    static bool isBinaryTrace(const std::string& path);
+    static void writeBinary(const std::string& path, const int* pages, size_t count);
+    static void writeBinary(const std::string& path, const int64_t* pages, size_t count);
+    static void validateHeader(const TraceFileHeader& header, size_t fileSize,
+                               const std::string& path);
+};
+
+#endif // TRACE_FILE_H
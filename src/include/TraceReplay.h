@@ -0,0 +1,54 @@
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+#include "PageReplacementAlgorithm.h"
+#include "WorkloadGenerator.h"
+#include <vector>
+#include <string>
+
+/**
+ * @brief Politicas disponiveis para replay de traces fora do menu
+ *
+ * Inclui os simuladores de comparacao (FIFO e Otimo), que nao fazem
+ * parte da hierarquia PageReplacementAlgorithm.
+ */
+enum class ReplayPolicy {
+    CLOCK,          // ClockAlgorithm
+    SECOND_CHANCE,  // SecondChanceAlgorithm
+    FIFO,           // FIFOSimulator
+    OPTIMAL,        // OptimalSimulator (Belady)
+    LRU,            // LRUAlgorithm
+    AGING,          // AgingAlgorithm
+    ARC,            // ARCAlgorithm
+    CAR             // CARAlgorithm
+};
+
+/**
+ * @brief Utilitarios para executar uma politica sobre um trace completo
+ */
+class TraceReplay {
+public:
+    static bool parsePolicy(const std::string& name, ReplayPolicy& policy);
+    static std::string getPolicyName(ReplayPolicy policy);
+    static std::vector<ReplayPolicy> getAllPolicies();
+    
+    // Executa a politica sem log nem debug e retorna as estatisticas
+    static AlgorithmStatistics replay(ReplayPolicy policy, int frames,
+                                      const std::vector<int>& pages);
+    static AlgorithmStatistics replay(ReplayPolicy policy, int frames,
+                                      const int* pages, size_t count);
+    
+    // Replay em streaming de um trace binario (memoria constante).
+    // O algoritmo otimo precisa do trace completo e nao e suportado.
+    static bool supportsStreaming(ReplayPolicy policy);
+    static AlgorithmStatistics replayStream(ReplayPolicy policy, int frames,
+                                            const std::string& path,
+                                            size_t chunkSize);
+    
+    // Replay de uma carga sintetica gerada sob demanda (mesmas restricoes)
+    static AlgorithmStatistics replayWorkload(ReplayPolicy policy, int frames,
+                                              const WorkloadConfig& workload,
+                                              size_t chunkSize);
+};
+
+#endif // TRACE_REPLAY_H
@@ -0,0 +1,72 @@
+#ifndef TRACE_STREAM_H
+#define TRACE_STREAM_H
+
+#include "TraceFile.h"
+#include "SparsePageMap.h"
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * @brief Leitura em streaming de traces binarios maiores que a RAM
+ *
+ * Uma thread de leitura preenche dois buffers de tamanho fixo de forma
+ * alternada (double buffering): enquanto o consumidor processa um bloco,
+ * o proximo ja esta sendo lido do disco. O uso de memoria e de
+ * 2 * chunkSize paginas, independente do tamanho do trace.
+ *
+ * Traces com IDs de 64 bits sao traduzidos para IDs densos na propria
+ * thread de leitura; o mapa cresce com as paginas distintas do trace.
+ * IDs negativos sao descartados e contados como referencias invalidas,
+ * como no trace de texto.
+ */
+class TraceStream {
+private:
+    std::ifstream file;
+    size_t chunkSize;
+    uint64_t referenceCount;      // Total de referencias no arquivo
+    uint64_t remaining;           // Referencias ainda nao lidas (thread de leitura)
+    uint32_t pageIdWidth;         // Bytes por ID no arquivo (4 ou 8)
+    std::vector<int64_t> wideBuffer;  // Bloco lido de um trace de 64 bits
+    SparsePageMap pageMap;        // IDs de 64 bits -> IDs densos (thread de leitura)
+    uint64_t invalidReferences;   // IDs negativos descartados
+    
+    std::vector<int> buffers[2];
+    size_t counts[2];
+    bool ready[2];                // Buffer cheio aguardando o consumidor
+    int consumerIndex;            // Proximo buffer a entregar
+    bool consumerHolding;         // Consumidor ainda usa buffers[consumerIndex]
+    bool finished;                // Thread de leitura terminou
+    bool stopRequested;
+    std::string error;
+    
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::thread reader;
+    
+    void readLoop();
+
+public:
+    static const size_t DEFAULT_CHUNK_SIZE = 1 << 20;
+    
+    explicit TraceStream(const std::string& path, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+    ~TraceStream();
+    
+    TraceStream(const TraceStream&) = delete;
+    TraceStream& operator=(const TraceStream&) = delete;
+    
+    // Entrega o proximo bloco; o anterior e devolvido a thread de leitura.
+    // Retorna false no fim do trace.
+    bool nextChunk(const int*& pages, size_t& count);
+    
+    uint64_t getReferenceCount() const { return referenceCount; }
+    
+    // Referencias descartadas ate o bloco atual (total depois do fim do trace)
+    uint64_t getInvalidReferences();
+    size_t getChunkSize() const { return chunkSize; }
+};
+
+#endif // TRACE_STREAM_H
@@ -0,0 +1,161 @@
+#ifndef TWO_HANDED_CLOCK_H
+#define TWO_HANDED_CLOCK_H
+
+#include "PageReplacementAlgorithm.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Parametros do daemon de paginas
+ */
+struct PageDaemonOptions {
+    int handSpread;       // Frames entre o ponteiro da frente e o de tras (-1 = metade da memoria)
+    int lowWatermark;     // Reserva livre abaixo da qual o daemon acorda (0 = memoria / 64)
+    int highWatermark;    // Reserva em que o daemon volta a dormir (0 = memoria / 32)
+    bool background;      // Daemon em thread propria; false = recupera dentro do fault
+    
+    PageDaemonOptions() : handSpread(-1), lowWatermark(0), highWatermark(0), background(true) {}
+};
+
+/**
+ * @brief Histograma de latencias em nanossegundos
+ *
+ * Quatro faixas por potencia de 2 (erro maximo de 25%), sem alocacao:
+ * registrar custa um count-leading-zeros e um incremento.
+ */
+class LatencyHistogram {
+private:
+    static const int BUCKETS = 252;
+    
+    uint64_t buckets[BUCKETS];
+    uint64_t count;
+    uint64_t totalNanoseconds;
+    uint64_t maxNanoseconds;
+    
+    static int bucketOf(uint64_t nanoseconds);
+    static uint64_t upperBound(int bucket);
+
+public:
+    LatencyHistogram() { reset(); }
+    
+    void record(uint64_t nanoseconds);
+    void reset();
+    
+    uint64_t getCount() const { return count; }
+    uint64_t getMax() const { return maxNanoseconds; }
+    double getMean() const { return count > 0 ? (double)totalNanoseconds / count : 0.0; }
+    
+    // Limite superior da faixa que contem o percentil (0 < fraction <= 1)
+    uint64_t getPercentile(double fraction) const;
+};
+
+/**
+ * @brief Trabalho do daemon de paginas
+ */
+struct PageDaemonStatistics {
+    uint64_t wakeups;          // Vezes que a reserva caiu abaixo da marca baixa
+    uint64_t framesScanned;    // Passos dos ponteiros
+    uint64_t bitsCleared;      // Bits zerados pelo ponteiro da frente
+    uint64_t framesReclaimed;  // Paginas retiradas pelo ponteiro de tras
+    double busySeconds;        // Tempo do daemon acordado
+    
+    PageDaemonStatistics()
+        : wakeups(0), framesScanned(0), bitsCleared(0), framesReclaimed(0), busySeconds(0.0) {}
+};
+
+/**
+ * @brief Clock de dois ponteiros com daemon de paginas
+ *
+ * Como no pageout dos kernels BSD/Solaris, a substituicao sai do fault:
+ *   - Reserva: fila de frames livres. O fault so retira um frame dela
+ *     em O(1); so espera o daemon (stall) se a reserva estiver vazia.
+ *   - Daemon: acorda quando a reserva cai abaixo de lowWatermark e
+ *     varre ate ela chegar a highWatermark. A cada passo o ponteiro da
+ *     frente zera o bit de referencia e o de tras, handSpread frames
+ *     atras, retira a pagina se o bit continuar zerado: a pagina tem o
+ *     tempo de percorrer o spread para ser referenciada de novo.
+ *   - Threads: uma thread de aplicacao (referencePage) e o daemon. Os
+ *     indices pagina -> frame e frame -> pagina e os bits sao atomicos;
+ *     a fila e de um produtor (daemon) e um consumidor (aplicacao).
+ *
+ * Com background = false a varredura roda dentro do fault que encontra
+ * a reserva abaixo da marca baixa: os resultados sao deterministicos e
+ * a latencia do fault inclui a varredura, como no ClockAlgorithm. As
+ * paginas sao IDs densos 0..pageCount-1.
+ */
+class TwoHandedClock {
+private:
+    static const int NOT_RESIDENT = -1;   // pageFrame: pagina fora da memoria
+    static const int FREE = -1;           // framePage: frame na reserva
+    
+    int memorySize;
+    int pageCount;
+    int handSpread;
+    int lowWatermark;
+    int highWatermark;
+    bool background;
+    
+    std::unique_ptr<std::atomic<int>[]> pageFrame;          // Pagina -> frame ou NOT_RESIDENT
+    std::unique_ptr<std::atomic<int>[]> framePage;          // Frame -> pagina ou FREE
+    std::unique_ptr<std::atomic<uint8_t>[]> referenceBits;  // Um byte por frame
+    std::unique_ptr<int[]> freeRing;                        // Reserva (fila circular)
+    std::atomic<uint64_t> freeHead;                         // Proximo a retirar (aplicacao)
+    std::atomic<uint64_t> freeTail;                         // Proximo a devolver (daemon)
+    int frontHand;
+    
+    // Estado da aplicacao
+    AlgorithmStatistics stats;
+    LatencyHistogram faultLatency;
+    uint64_t stalls;                                        // Faults com a reserva vazia
+    
+    // Estado do daemon
+    PageDaemonStatistics daemonStats;
+    std::thread daemon;
+    std::mutex daemonMutex;
+    std::condition_variable daemonWake;
+    std::atomic<bool> daemonActive;
+    std::atomic<bool> stopping;
+    
+    int freeFrames() const {
+        return static_cast<int>(freeTail.load(std::memory_order_acquire) -
+                                freeHead.load(std::memory_order_acquire));
+    }
+    void sweepStep();
+    void refill();
+    void wakeDaemon();
+    void daemonLoop();
+    void startDaemon();
+    void stopDaemon();
+
+public:
+    TwoHandedClock(int frames, int pageCount, const PageDaemonOptions& options);
+    ~TwoHandedClock();
+    
+    TwoHandedClock(const TwoHandedClock&) = delete;
+    TwoHandedClock& operator=(const TwoHandedClock&) = delete;
+    
+    // Thread da aplicacao (uma so); sem o daemon rodando, a varredura roda no fault
+    bool referencePage(int pageNumber);
+    
+    // Inicia o daemon, referencia o trace e o encerra; retorna o tempo em segundos
+    double replay(const int* pages, size_t count);
+    
+    // Nao pode ser chamado durante o replay
+    void reset();
+    
+    const AlgorithmStatistics& getStatistics() const { return stats; }
+    const LatencyHistogram& getFaultLatency() const { return faultLatency; }
+    uint64_t getStalls() const { return stalls; }
+    const PageDaemonStatistics& getDaemonStatistics() const { return daemonStats; }
+    int getMemorySize() const { return memorySize; }
+    int getHandSpread() const { return handSpread; }
+    int getLowWatermark() const { return lowWatermark; }
+    int getHighWatermark() const { return highWatermark; }
+};
+
+#endif // TWO_HANDED_CLOCK_H
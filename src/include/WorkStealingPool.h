@@ -0,0 +1,63 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <exception>
+
+/**
+ * @brief Pool de threads com roubo de tarefas (work stealing)
+ *
+ * Cada worker tem sua propria fila. Tarefas submetidas sao distribuidas
+ * em rodizio; o worker consome a propria fila na ordem de submissao e,
+ * quando ela esvazia, rouba do inicio da fila de outro worker. Assim
+ * tarefas de custo desigual (ex.: OPT com muitos frames) nao deixam
+ * cores ociosos, e quem submete as mais caras primeiro as ve rodar
+ * primeiro.
+ */
+class WorkStealingPool {
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+    
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextQueue;    // Rodizio de submissao
+    std::atomic<size_t> queuedTasks;  // Tarefas ainda nas filas
+    size_t pendingTasks;              // Tarefas nao concluidas (protegido por stateMutex)
+    bool stopping;
+    std::exception_ptr firstError;    // Primeira excecao lancada por uma tarefa
+    
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+    
+    bool popLocal(size_t index, std::function<void()>& task);
+    bool steal(size_t thief, std::function<void()>& task);
+    void workerLoop(size_t index);
+
+public:
+    // threadCount <= 0 usa o numero de cores da maquina
+    explicit WorkStealingPool(int threadCount = 0);
+    ~WorkStealingPool();
+    
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+    
+    void submit(std::function<void()> task);
+    void wait();
+    
+    int getThreadCount() const { return static_cast<int>(workers.size()); }
+    
+    static int getDefaultThreadCount();
+};
+
+#endif // WORK_STEALING_POOL_H
@@ -0,0 +1,98 @@
+#ifndef WORKLOAD_GENERATOR_H
+#define WORKLOAD_GENERATOR_H
+
+#include <vector>
+#include <string>
+#include <random>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Distribuicoes de referencias disponiveis
+ */
+enum class WorkloadType {
+    UNIFORM,    // Uniforme sobre 0..pageCount-1
+    ZIPF,       // Zipf(alpha): pagina k com probabilidade ~ 1/(k+1)^alpha
+    SCAN,       // Varredura sequencial 0, 1, ..., pageCount-1, 0, ...
+    LOOP,       // Laco sobre 0..workingSetSize-1
+    PHASED      // Working sets que mudam a cada phaseLength referencias
+};
+
+/**
+ * @brief Parametros de uma carga sintetica
+ */
+struct WorkloadConfig {
+    WorkloadType type;
+    uint64_t length;          // Numero total de referencias
+    int pageCount;            // Tamanho do espaco de paginas (LOOP usa workingSetSize)
+    int workingSetSize;       // Laco (LOOP) ou working set de cada fase (PHASED)
+    uint64_t phaseLength;     // Referencias por fase (PHASED)
+    double locality;          // Fracao de referencias dentro do working set (PHASED)
+    double zipfAlpha;         // Expoente da Zipf (> 0)
+    uint64_t seed;
+    
+    WorkloadConfig() : type(WorkloadType::UNIFORM), length(1000000), pageCount(1000),
+                       workingSetSize(100), phaseLength(100000), locality(0.9),
+                       zipfAlpha(1.0), seed(1) {}
+};
+
+/**
+ * @brief Gerador deterministico de referencias, produzidas em blocos
+ *
+ * A mesma configuracao (incluindo a semente) gera sempre a mesma
+ * sequencia, em qualquer plataforma e com qualquer tamanho de bloco.
+ * As referencias sao produzidas sob demanda, entao cargas de bilhoes de
+ * referencias usam apenas o buffer de um bloco. A interface nextChunk
+ * e a mesma do TraceStream.
+ */
+class WorkloadGenerator {
+private:
+    WorkloadConfig config;
+    std::mt19937_64 rng;
+    uint64_t produced;        // Referencias ja geradas
+    int phaseBase;            // Primeira pagina do working set da fase atual
+    std::vector<int> buffer;  // Bloco entregue por nextChunk
+    
+    // Constantes da amostragem Zipf por rejeicao-inversao
+    double zipfIntegralX1;
+    double zipfIntegralN;
+    double zipfThreshold;
+    
+    void validate() const;
+    void initializeZipf();
+    double nextUniform();
+    int nextBelow(int bound);
+    int nextZipf();
+    double zipfH(double x) const;
+    double zipfIntegral(double x) const;
+    double zipfIntegralInverse(double x) const;
+
+public:
+    static const size_t DEFAULT_BLOCK_SIZE = 1 << 16;
+    
+    explicit WorkloadGenerator(const WorkloadConfig& config,
+                               size_t blockSize = DEFAULT_BLOCK_SIZE);
+    
+    // Preenche ate maxCount referencias; retorna quantas foram geradas (0 no fim)
+    size_t generate(int* out, size_t maxCount);
+    
+    // Entrega o proximo bloco; o ponteiro vale ate a proxima chamada
+    bool nextChunk(const int*& pages, size_t& count);
+    
+    // Recomeca a mesma sequencia
+    void reset();
+    
+    const WorkloadConfig& getConfig() const { return config; }
+    uint64_t getProduced() const { return produced; }
+    
+    // Gera a carga inteira em memoria (para politicas que precisam do trace completo)
+    static std::vector<int> materialize(const WorkloadConfig& config);
+    
+    // Especificacao textual: tipo[:chave=valor,...]
+    // chaves: length, pages, ws, phase, locality, alpha, seed
+    static WorkloadConfig parseSpec(const std::string& spec);
+    static bool parseType(const std::string& name, WorkloadType& type);
+    static std::string getTypeName(WorkloadType type);
+};
+
+#endif // WORKLOAD_GENERATOR_H
@@ -0,0 +1,194 @@
+#include "../include/ARCAlgorithm.h"
+#include "../include/Logger.h"
+#include <algorithm>
+
+typedef AdaptiveDirectory Dir;
+
+/**
+ * @brief Construtor do ARC
+ * @param size Numero de frames
+ */
+ARCAlgorithm::ARCAlgorithm(int size, bool debug)
+    : PageReplacementAlgorithm(size, debug), directory(size), target(0) {
+    
+    if (debugMode) {
+        std::cout << "ARCAlgorithm inicializado com " << size << " frames\n";
+    }
+}
+
+/**
+ * @brief Libera um frame: a pagina mais antiga de T1 vai para B1 ou a de
+ *        T2 vai para B2, conforme o tamanho de T1 em relacao ao alvo p
+ * @param ghostInB2 O fault e de uma pagina de B2 (empate favorece T2)
+ */
+void ARCAlgorithm::replace(bool ghostInB2) {
+    int t1 = directory.size(Dir::T1);
+    bool fromT1 = t1 >= 1 && ((ghostInB2 && t1 == target) || t1 > target ||
+                              directory.size(Dir::T2) == 0);
+    
+    int victim = directory.front(fromT1 ? Dir::T1 : Dir::T2);
+    lastEvictedPage = directory[victim].page;
+    directory.move(victim, fromT1 ? Dir::B1 : Dir::B2);
+}
+
+/**
+ * @brief Nucleo do ARC, sem mensagens de debug
+ * @param pageNumber Numero da pagina a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+inline bool ARCAlgorithm::touchPage(int pageNumber) {
+    stats.totalReferences++;
+    targetHistory.tick(stats.totalReferences, target);
+    lastEvictedPage = -1;
+    
+    int entry = directory.find(pageNumber);
+    if (entry != Dir::NONE && Dir::isResident(directory[entry])) {
+        // Hit em T1 ou T2: a pagina passa a ser a mais recente de T2
+        stats.hits++;
+        directory.move(entry, Dir::T2);
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_HIT, "arc",
+                    stats.totalReferences, pageNumber, directory[entry].frame);
+        return false;
+    }
+    
+    stats.pageFaults++;
+    int b1 = directory.size(Dir::B1);
+    int b2 = directory.size(Dir::B2);
+    
+    if (entry != Dir::NONE) {
+        // Fantasma: ajusta p para o lado que teria evitado o fault
+        bool inB1 = directory[entry].list == Dir::B1;
+        if (inB1) {
+            target = std::min(memorySize, target + std::max(1, b2 / b1));
+        } else {
+            target = std::max(0, target - std::max(1, b1 / b2));
+        }
+        replace(!inB1);
+        directory.move(entry, Dir::T2);
+    } else {
+        int t1 = directory.size(Dir::T1);
+        if (t1 + b1 == memorySize) {
+            if (t1 < memorySize) {
+                directory.erase(directory.front(Dir::B1));
+                replace(false);
+            } else {
+                // B1 vazia e T1 ocupa a memoria: a pagina sai sem fantasma
+                int victim = directory.front(Dir::T1);
+                lastEvictedPage = directory[victim].page;
+                directory.erase(victim);
+            }
+        } else if (directory.getEntryCount() >= memorySize) {
+            if (directory.getEntryCount() == 2 * memorySize) {
+                directory.erase(directory.front(Dir::B2));
+            }
+            replace(false);
+        }
+        entry = directory.insert(pageNumber, Dir::T1);
+    }
+    
+    int frame = directory[entry].frame;
+    Logger::log(LogLevel::TRACE, LogEventType::PAGE_FAULT, "arc",
+                stats.totalReferences, pageNumber, frame);
+    if (lastEvictedPage != -1) {
+        Logger::log(LogLevel::DEBUG, LogEventType::PAGE_EVICTED, "arc",
+                    stats.totalReferences, pageNumber, frame, lastEvictedPage);
+    }
+    return true;
+}
+
+/**
+ * @brief Processa um lote de referencias em um laco sem despacho virtual
+ */
+const AlgorithmStatistics& ARCAlgorithm::referencePages(const int* pages, size_t n,
+                                                        uint8_t* outHitMask) {
+    return replayBatch(pages, n, outHitMask,
+                       [this](int page) { return touchPage(page); });
+}
+
+/**
+ * @brief Referencia uma pagina
+ * @param pageNumber Numero da pagina a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+bool ARCAlgorithm::referencePage(int pageNumber) {
+    if (!debugMode) {
+        return touchPage(pageNumber);
+    }
+    
+    std::cout << "\n--- Referencia a pagina " << pageNumber << " ---\n";
+    
+    int entry = directory.find(pageNumber);
+    int list = entry != Dir::NONE ? directory[entry].list : -1;
+    int previousTarget = target;
+    
+    bool fault = touchPage(pageNumber);
+    if (!fault) {
+        std::cout << "HIT: Pagina " << pageNumber << " em " << (list == Dir::T1 ? "T1" : "T2")
+                  << ", vai para o fim de T2\n";
+    } else {
+        std::cout << "MISS: Pagina " << pageNumber;
+        if (list == Dir::B1 || list == Dir::B2) {
+            std::cout << " lembrada em " << (list == Dir::B1 ? "B1" : "B2")
+                      << " (p: " << previousTarget << " -> " << target << "), entra em T2";
+        } else {
+            std::cout << " nova, entra em T1";
+        }
+        if (lastEvictedPage != -1) {
+            std::cout << "; substitui pagina " << lastEvictedPage;
+        }
+        std::cout << "\n";
+    }
+    
+    displayMemoryState();
+    std::cout << "\n";
+    return fault;
+}
+
+/**
+ * @brief Exibe as quatro listas (da pagina mais antiga para a mais recente)
+ */
+void ARCAlgorithm::displayMemoryState() const {
+    directory.display(false);
+    displayStatistics();
+}
+
+/**
+ * @brief Implementacao do displayMemory para interface
+ */
+void ARCAlgorithm::displayMemory() const {
+    displayMemoryState();
+}
+
+/**
+ * @brief Estatisticas e o alvo p atual
+ */
+void ARCAlgorithm::displayStatistics() const {
+    PageReplacementAlgorithm::displayStatistics();
+    std::cout << " | p: " << target << "/" << memorySize;
+}
+
+/**
+ * @brief Reseta o algoritmo
+ */
+void ARCAlgorithm::reset() {
+    directory.clear();
+    target = 0;
+    targetHistory.clear();
+    lastEvictedPage = -1;
+    stats.reset();
+    
+    if (debugMode) {
+        std::cout << "ARCAlgorithm resetado\n";
+    }
+}
+
+/**
+ * @brief Retorna as paginas atualmente na memoria
+ * @return Paginas de T1 e depois de T2, cada lista da mais antiga para a mais recente
+ */
+std::vector<int> ARCAlgorithm::getCurrentPages() const {
+    std::vector<int> pages = directory.getPages(Dir::T1);
+    std::vector<int> frequent = directory.getPages(Dir::T2);
+    pages.insert(pages.end(), frequent.begin(), frequent.end());
+    return pages;
+}
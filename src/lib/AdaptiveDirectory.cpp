@@ -0,0 +1,101 @@
+#include "../include/AdaptiveDirectory.h"
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Registra uma amostra; ao encher, descarta metade e dobra o intervalo
+ *
+ * As amostras ficam nos passos interval, 2 * interval, ...; as que
+ * sobram (posicoes impares) sao as dos multiplos do novo intervalo.
+ */
+void TargetHistory::append(uint64_t step, int target) {
+    TargetSample sample = {step, target};
+    samples.push_back(sample);
+    untilSample = interval;
+    
+    if (samples.size() == CAPACITY) {
+        for (size_t i = 1; i < CAPACITY; i += 2) {
+            samples[i / 2] = samples[i];
+        }
+        samples.resize(CAPACITY / 2);
+        interval *= 2;
+        untilSample = interval;
+    }
+}
+
+/**
+ * @brief Esvazia o historico (amostra a cada referencia)
+ */
+void TargetHistory::clear() {
+    samples.clear();
+    samples.reserve(CAPACITY);
+    interval = 1;
+    untilSample = 1;
+}
+
+/**
+ * @brief Construtor: diretorio vazio com 2 * frames entradas
+ * @param frames Frames da memoria fisica
+ */
+AdaptiveDirectory::AdaptiveDirectory(int frames) : frameCount(frames) {
+    if (frames <= 0) {
+        throw std::invalid_argument("Tamanho da memoria deve ser positivo");
+    }
+    
+    entries.resize(2 * static_cast<size_t>(frames));
+    index.reserve(entries.size());
+    clear();
+}
+
+/**
+ * @brief Esvazia as quatro listas e devolve entradas e frames as reservas
+ */
+void AdaptiveDirectory::clear() {
+    for (List& list : lists) {
+        list.head = NONE;
+        list.tail = NONE;
+        list.size = 0;
+    }
+    
+    // Pilhas em ordem decrescente: entradas e frames saem a partir do 0
+    freeEntries.clear();
+    for (int entry = static_cast<int>(entries.size()) - 1; entry >= 0; --entry) {
+        freeEntries.push_back(entry);
+    }
+    freeFrames.clear();
+    for (int frame = frameCount - 1; frame >= 0; --frame) {
+        freeFrames.push_back(frame);
+    }
+    index.clear();
+}
+
+/**
+ * @brief Paginas de uma lista, da mais antiga para a mais recente
+ */
+std::vector<int> AdaptiveDirectory::getPages(ListId list) const {
+    std::vector<int> pages;
+    pages.reserve(lists[list].size);
+    for (int entry = lists[list].head; entry != NONE; entry = entries[entry].next) {
+        pages.push_back(entries[entry].page);
+    }
+    return pages;
+}
+
+/**
+ * @brief Imprime as quatro listas, da pagina mais antiga para a mais recente
+ * @param referenceBits Marca com * as paginas residentes com bit ligado
+ */
+void AdaptiveDirectory::display(bool referenceBits) const {
+    static const char* const NAMES[] = {"T1", "T2", "| B1", "B2"};
+    
+    for (int list = T1; list <= B2; ++list) {
+        std::cout << NAMES[list] << ": [";
+        for (int entry = lists[list].head; entry != NONE; entry = entries[entry].next) {
+            std::cout << (entry != lists[list].head ? " " : "") << entries[entry].page;
+            if (referenceBits && list <= T2 && entries[entry].referenced) {
+                std::cout << "*";
+            }
+        }
+        std::cout << "] ";
+    }
+}
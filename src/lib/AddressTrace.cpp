@@ -0,0 +1,401 @@
+#include "../include/AddressTrace.h"
+#include "../include/WorkStealingPool.h"
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ADDRESS_TRACE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Enderecos de um bloco do arquivo de texto
+ */
+struct ParsedBlock {
+    std::vector<uint64_t> addresses;
+    uint64_t skippedLines;
+    
+    ParsedBlock() : skippedLines(0) {}
+};
+
+/**
+ * @brief Conversao escalar (qualquer arquitetura)
+ */
+static void toPagesScalar(const uint64_t* addresses, size_t count,
+                          uint64_t mask, int shift, int64_t* pages) {
+    for (size_t i = 0; i < count; ++i) {
+        pages[i] = static_cast<int64_t>((addresses[i] & mask) >> shift);
+    }
+}
+
+#ifdef ADDRESS_TRACE_X86_SIMD
+
+/**
+ * @brief Conversao com SSE2: 2 enderecos por instrucao
+ */
+__attribute__((target("sse2")))
+static void toPagesSse2(const uint64_t* addresses, size_t count,
+                        uint64_t mask, int shift, int64_t* pages) {
+    const __m128i maskVector = _mm_set1_epi64x(static_cast<long long>(mask));
+    const __m128i shiftCount = _mm_cvtsi32_si128(shift);
+    size_t i = 0;
+    
+    for (; i + 2 <= count; i += 2) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(addresses + i));
+        block = _mm_srl_epi64(_mm_and_si128(block, maskVector), shiftCount);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pages + i), block);
+    }
+    
+    toPagesScalar(addresses + i, count - i, mask, shift, pages + i);
+}
+
+/**
+ * @brief Conversao com AVX2: 4 enderecos por instrucao
+ *
+ * Dois vetores por iteracao, para que a latencia das cargas se sobreponha.
+ */
+__attribute__((target("avx2")))
+static void toPagesAvx2(const uint64_t* addresses, size_t count,
+                        uint64_t mask, int shift, int64_t* pages) {
+    const __m256i maskVector = _mm256_set1_epi64x(static_cast<long long>(mask));
+    const __m128i shiftCount = _mm_cvtsi32_si128(shift);
+    size_t i = 0;
+    
+    for (; i + 8 <= count; i += 8) {
+        const __m256i* source = reinterpret_cast<const __m256i*>(addresses + i);
+        __m256i low = _mm256_loadu_si256(source);
+        __m256i high = _mm256_loadu_si256(source + 1);
+        low = _mm256_srl_epi64(_mm256_and_si256(low, maskVector), shiftCount);
+        high = _mm256_srl_epi64(_mm256_and_si256(high, maskVector), shiftCount);
+        __m256i* target = reinterpret_cast<__m256i*>(pages + i);
+        _mm256_storeu_si256(target, low);
+        _mm256_storeu_si256(target + 1, high);
+    }
+    
+    toPagesScalar(addresses + i, count - i, mask, shift, pages + i);
+}
+
+#endif
+
+const char* AddressTrace::convertName = "scalar";
+AddressTrace::PageFunction AddressTrace::convert = AddressTrace::selectConvert();
+
+/**
+ * @brief Escolhe a conversao mais larga suportada pela CPU
+ */
+AddressTrace::PageFunction AddressTrace::selectConvert() {
+#ifdef ADDRESS_TRACE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        convertName = "avx2";
+        return toPagesAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        convertName = "sse2";
+        return toPagesSse2;
+    }
+#endif
+    convertName = "scalar";
+    return toPagesScalar;
+}
+
+/**
+ * @brief Nome da conversao em uso
+ */
+const char* AddressTrace::getConvertName() {
+    return convertName;
+}
+
+/**
+ * @brief Converte enderecos em numeros de pagina
+ * @param mask Mascara dos bits significativos do endereco
+ * @param shift log2 do tamanho da pagina
+ */
+void AddressTrace::toPages(const uint64_t* addresses, size_t count,
+                           uint64_t mask, int shift, int64_t* pages) {
+    convert(addresses, count, mask, shift, pages);
+}
+
+/**
+ * @brief Valor de um digito hexadecimal, ou -1
+ */
+static int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/**
+ * @brief Le um numero hexadecimal (sem prefixo) a partir de p
+ * @return Posicao apos o ultimo digito, ou nullptr se nao houver digitos
+ *         ou o valor exceder 64 bits
+ */
+static const char* parseHex(const char* p, const char* end, uint64_t& value) {
+    const char* start = p;
+    value = 0;
+    for (int digit; p < end && (digit = hexDigit(*p)) >= 0; ++p) {
+        if (p - start == 16) {
+            return nullptr;
+        }
+        value = (value << 4) | static_cast<uint64_t>(digit);
+    }
+    return p == start ? nullptr : p;
+}
+
+/**
+ * @brief Linha do Lackey: " L 04f6b868,8" (operacoes I, L, S e M)
+ *
+ * Cada linha conta como um acesso, inclusive M (load + store no mesmo
+ * endereco) e acessos que cruzam o fim da pagina.
+ */
+static bool parseLackeyLine(const char* p, const char* end, uint64_t& address) {
+    while (p < end && *p == ' ') ++p;
+    if (p == end || (*p != 'I' && *p != 'L' && *p != 'S' && *p != 'M')) {
+        return false;
+    }
+    ++p;
+    if (p == end || *p != ' ') {
+        return false;
+    }
+    while (p < end && *p == ' ') ++p;
+    
+    p = parseHex(p, end, address);
+    return p != nullptr && p < end && *p == ',';
+}
+
+/**
+ * @brief Linha do perf mem report -D: o endereco de dados e o 4o campo
+ *
+ * Os campos sao separados por espacos ou, com -x ',', por virgulas.
+ */
+static bool parsePerfLine(const char* p, const char* end, uint64_t& address) {
+    const int ADDRESS_FIELD = 3;
+    for (int field = 0; ; ++field) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == ',')) ++p;
+        if (p == end) {
+            return false;
+        }
+        if (field == ADDRESS_FIELD) {
+            break;
+        }
+        while (p < end && *p != ' ' && *p != '\t' && *p != ',') ++p;
+    }
+    
+    if (end - p < 3 || p[0] != '0' || (p[1] != 'x' && p[1] != 'X')) {
+        return false;
+    }
+    p = parseHex(p + 2, end, address);
+    return p != nullptr && (p == end || *p == ' ' || *p == '\t' || *p == ',');
+}
+
+/**
+ * @brief Linhas vazias e comentarios, que nao contam como ignoradas
+ *
+ * '#' inicia os cabecalhos do perf; '==' as mensagens do Valgrind.
+ */
+static bool isCommentLine(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    return p == end || *p == '#' || (end - p >= 2 && p[0] == '=' && p[1] == '=');
+}
+
+/**
+ * @brief Analisa as linhas de [begin, end) (o bloco termina em fim de linha)
+ */
+static void parseBlock(const char* begin, const char* end, AddressFormat format,
+                       ParsedBlock& block) {
+    block.addresses.reserve((end - begin) / 16);
+    
+    for (const char* line = begin; line < end; ) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+        
+        uint64_t address;
+        bool parsed = format == AddressFormat::LACKEY ? parseLackeyLine(line, lineEnd, address)
+                                                      : parsePerfLine(line, lineEnd, address);
+        if (parsed) {
+            block.addresses.push_back(address);
+        } else if (!isCommentLine(line, lineEnd)) {
+            block.skippedLines++;
+        }
+        
+        line = lineEnd + 1;
+    }
+}
+
+/**
+ * @brief Le o arquivo inteiro
+ */
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Nao foi possivel abrir o trace: " + path);
+    }
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Importa um trace de enderecos
+ * @param path Arquivo de texto (Lackey, perf) ou binario (RAW)
+ * @param options Formato, tamanho da pagina, bits do endereco e threads
+ *
+ * Os blocos sao analisados em paralelo; depois cada bloco e convertido
+ * para paginas na sua posicao do vetor final, tambem em paralelo, entao
+ * a ordem dos acessos e preservada.
+ */
+AddressTraceImport AddressTrace::import(const std::string& path, const AddressTraceOptions& options) {
+    const size_t MIN_BLOCK_BYTES = 1 << 20;
+    
+    if (options.pageSize < MIN_PAGE_SIZE || (options.pageSize & (options.pageSize - 1)) != 0) {
+        throw std::invalid_argument("Tamanho de pagina deve ser potencia de 2 >= 512");
+    }
+    if (options.addressBits < 1 || options.addressBits > 64) {
+        throw std::invalid_argument("Bits de endereco devem estar entre 1 e 64");
+    }
+    
+    int shift = 0;
+    while ((uint64_t(1) << shift) < options.pageSize) {
+        ++shift;
+    }
+    uint64_t mask = options.addressBits == 64 ? ~uint64_t(0)
+                                              : (uint64_t(1) << options.addressBits) - 1;
+    
+    int threads = options.threadCount > 0 ? options.threadCount
+                                          : WorkStealingPool::getDefaultThreadCount();
+    std::string content = readFile(path);
+    std::vector<ParsedBlock> blocks;
+    
+    if (options.format == AddressFormat::RAW) {
+        if (content.size() % sizeof(uint64_t) != 0) {
+            throw std::runtime_error("Trace de enderecos truncado (tamanho nao multiplo de 8): " + path);
+        }
+        blocks.resize(1);
+        blocks[0].addresses.resize(content.size() / sizeof(uint64_t));
+        if (!content.empty()) {
+            std::memcpy(blocks[0].addresses.data(), content.data(), content.size());
+        }
+    } else {
+        // Blocos de pelo menos 1 MB, varios por thread para balancear
+        size_t blockCount = std::max<size_t>(1, std::min<size_t>(threads * 4,
+                                                                 content.size() / MIN_BLOCK_BYTES));
+        std::vector<const char*> bounds(1, content.data());
+        const char* end = content.data() + content.size();
+        for (size_t b = 1; b < blockCount; ++b) {
+            const char* cut = std::max(bounds.back(), content.data() + content.size() * b / blockCount);
+            const char* newline = static_cast<const char*>(std::memchr(cut, '\n', end - cut));
+            if (newline == nullptr) {
+                break;
+            }
+            bounds.push_back(newline + 1);
+        }
+        bounds.push_back(end);
+        
+        blocks.resize(bounds.size() - 1);
+        WorkStealingPool pool(std::min<int>(threads, static_cast<int>(blocks.size())));
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            pool.submit([&, b] { parseBlock(bounds[b], bounds[b + 1], options.format, blocks[b]); });
+        }
+        pool.wait();
+    }
+    std::string().swap(content);
+    
+    AddressTraceImport result;
+    std::vector<size_t> offsets;
+    size_t total = 0;
+    for (const auto& block : blocks) {
+        offsets.push_back(total);
+        total += block.addresses.size();
+        result.skippedLines += block.skippedLines;
+    }
+    result.pages.resize(total);
+    
+    // Conversao em fatias de tamanho parecido, cada uma na sua posicao final
+    const size_t SLICE = 1 << 20;
+    WorkStealingPool pool(threads);
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        const std::vector<uint64_t>& addresses = blocks[b].addresses;
+        for (size_t start = 0; start < addresses.size(); start += SLICE) {
+            size_t count = std::min(SLICE, addresses.size() - start);
+            int64_t* target = result.pages.data() + offsets[b] + start;
+            pool.submit([&addresses, start, count, mask, shift, target] {
+                toPages(addresses.data() + start, count, mask, shift, target);
+            });
+        }
+    }
+    pool.wait();
+    
+    return result;
+}
+
+/**
+ * @brief Converte nome em formato de trace de enderecos
+ */
+bool AddressTrace::parseFormat(const std::string& name, AddressFormat& format) {
+    if (name == "lackey") {
+        format = AddressFormat::LACKEY;
+    } else if (name == "perf" || name == "perf-mem") {
+        format = AddressFormat::PERF_MEM;
+    } else if (name == "raw") {
+        format = AddressFormat::RAW;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Nome do formato de trace de enderecos
+ */
+std::string AddressTrace::getFormatName(AddressFormat format) {
+    switch (format) {
+        case AddressFormat::LACKEY: return "lackey";
+        case AddressFormat::PERF_MEM: return "perf";
+        case AddressFormat::RAW: return "raw";
+        default: return "unknown";
+    }
+}
+
+/**
+ * @brief Le um tamanho de pagina (ex.: 4096, 4K, 16K, 2M, 1G)
+ * @return false se o texto for invalido ou nao for potencia de 2 >= 512
+ */
+bool AddressTrace::parsePageSize(const std::string& text, uint64_t& pageSize) {
+    if (text.empty()) {
+        return false;
+    }
+    
+    size_t digits = 0;
+    uint64_t value = 0;
+    while (digits < text.size() && text[digits] >= '0' && text[digits] <= '9') {
+        if (value > (uint64_t(1) << 40)) {
+            return false;
+        }
+        value = value * 10 + static_cast<uint64_t>(text[digits] - '0');
+        ++digits;
+    }
+    if (digits == 0) {
+        return false;
+    }
+    
+    std::string suffix = text.substr(digits);
+    if (suffix == "K" || suffix == "k") {
+        value <<= 10;
+    } else if (suffix == "M" || suffix == "m") {
+        value <<= 20;
+    } else if (suffix == "G" || suffix == "g") {
+        value <<= 30;
+    } else if (!suffix.empty()) {
+        return false;
+    }
+    
+    if (value < MIN_PAGE_SIZE || (value & (value - 1)) != 0) {
+        return false;
+    }
+    pageSize = value;
+    return true;
+}
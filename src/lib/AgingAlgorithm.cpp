@@ -0,0 +1,348 @@
+#include "../include/AgingAlgorithm.h"
+#include "../include/Logger.h"
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define AGING_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Deslocamento escalar (qualquer arquitetura)
+ */
+static void shiftScalar(uint8_t* counters, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        counters[i] >>= 1;
+    }
+}
+
+/**
+ * @brief Menor contador, escalar
+ */
+static uint8_t minimumScalar(const uint8_t* counters, size_t count) {
+    uint8_t result = 0xFF;
+    for (size_t i = 0; i < count; ++i) {
+        result = std::min(result, counters[i]);
+    }
+    return result;
+}
+
+#ifdef AGING_X86_SIMD
+
+/**
+ * @brief Deslocamento com SSE2: 16 contadores por instrucao
+ *
+ * Nao ha deslocamento de bytes: desloca palavras de 16 bits e limpa o
+ * bit que vem do byte vizinho.
+ */
+__attribute__((target("sse2")))
+static void shiftSse2(uint8_t* counters, size_t count) {
+    const __m128i keep = _mm_set1_epi8(0x7F);
+    size_t i = 0;
+    
+    for (; i + 16 <= count; i += 16) {
+        __m128i* block = reinterpret_cast<__m128i*>(counters + i);
+        __m128i value = _mm_loadu_si128(block);
+        _mm_storeu_si128(block, _mm_and_si128(_mm_srli_epi16(value, 1), keep));
+    }
+    
+    shiftScalar(counters + i, count - i);
+}
+
+/**
+ * @brief Menor contador com SSE2: 16 contadores por instrucao
+ */
+__attribute__((target("sse2")))
+static uint8_t minimumSse2(const uint8_t* counters, size_t count) {
+    __m128i lowest = _mm_set1_epi8(static_cast<char>(0xFF));
+    size_t i = 0;
+    
+    for (; i + 16 <= count; i += 16) {
+        lowest = _mm_min_epu8(lowest, _mm_loadu_si128(reinterpret_cast<const __m128i*>(counters + i)));
+    }
+    
+    uint8_t lanes[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), lowest);
+    return std::min(minimumScalar(lanes, 16), minimumScalar(counters + i, count - i));
+}
+
+/**
+ * @brief Deslocamento com AVX2: 32 contadores por instrucao
+ */
+__attribute__((target("avx2")))
+static void shiftAvx2(uint8_t* counters, size_t count) {
+    const __m256i keep = _mm256_set1_epi8(0x7F);
+    size_t i = 0;
+    
+    for (; i + 32 <= count; i += 32) {
+        __m256i* block = reinterpret_cast<__m256i*>(counters + i);
+        __m256i value = _mm256_loadu_si256(block);
+        _mm256_storeu_si256(block, _mm256_and_si256(_mm256_srli_epi16(value, 1), keep));
+    }
+    
+    shiftScalar(counters + i, count - i);
+}
+
+/**
+ * @brief Menor contador com AVX2: 32 contadores por instrucao
+ */
+__attribute__((target("avx2")))
+static uint8_t minimumAvx2(const uint8_t* counters, size_t count) {
+    __m256i lowest = _mm256_set1_epi8(static_cast<char>(0xFF));
+    size_t i = 0;
+    
+    for (; i + 32 <= count; i += 32) {
+        lowest = _mm256_min_epu8(lowest,
+                                 _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counters + i)));
+    }
+    
+    uint8_t lanes[32];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), lowest);
+    return std::min(minimumScalar(lanes, 32), minimumScalar(counters + i, count - i));
+}
+
+#endif
+
+const char* AgingAlgorithm::kernelName = "scalar";
+AgingAlgorithm::MinimumFunction AgingAlgorithm::minimum = minimumScalar;
+AgingAlgorithm::ShiftFunction AgingAlgorithm::shift = AgingAlgorithm::selectShift();
+
+/**
+ * @brief Escolhe o deslocamento e a busca mais largos suportados pela CPU
+ *
+ * Executada uma unica vez, na inicializacao estatica do programa. As
+ * duas funcoes sao escolhidas juntas; minimum e kernelName ja tem o
+ * valor escalar (inicializacao constante) quando ela roda.
+ */
+AgingAlgorithm::ShiftFunction AgingAlgorithm::selectShift() {
+#ifdef AGING_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        kernelName = "avx2";
+        minimum = minimumAvx2;
+        return shiftAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        kernelName = "sse2";
+        minimum = minimumSse2;
+        return shiftSse2;
+    }
+#endif
+    kernelName = "scalar";
+    minimum = minimumScalar;
+    return shiftScalar;
+}
+
+/**
+ * @brief Nome da implementacao vetorial em uso
+ */
+const char* AgingAlgorithm::getKernelName() {
+    return kernelName;
+}
+
+/**
+ * @brief Construtor do Aging
+ * @param size Numero de frames
+ * @param interval Referencias entre deslocamentos (0 = size)
+ */
+AgingAlgorithm::AgingAlgorithm(int size, bool debug, int interval)
+    : PageReplacementAlgorithm(size, debug), loadedFrames(0),
+      tickInterval(interval > 0 ? interval : size), untilTick(0), nextVictim(0), lowestHint(0),
+      ticks(0) {
+    
+    if (size <= 0) {
+        throw std::invalid_argument("Tamanho da memoria deve ser positivo");
+    }
+    if (interval < 0) {
+        throw std::invalid_argument("Intervalo de envelhecimento nao pode ser negativo");
+    }
+    
+    pages.assign(size, -1);
+    counters.assign(size, 0);
+    untilTick = tickInterval;
+    pageTable.reserve(size);
+    
+    if (debugMode) {
+        std::cout << "AgingAlgorithm inicializado com " << size << " frames (deslocamento a cada "
+                  << tickInterval << " referencias)\n";
+    }
+}
+
+/**
+ * @brief Primeiro frame com o contador informado, a partir de nextVictim
+ *        em ordem circular
+ * @return Indice do frame ou -1
+ */
+int AgingAlgorithm::findCounter(uint8_t value) const {
+    const uint8_t* base = counters.data();
+    const void* found = std::memchr(base + nextVictim, value, counters.size() - nextVictim);
+    if (!found) {
+        found = std::memchr(base, value, nextVictim);
+    }
+    return found ? static_cast<int>(static_cast<const uint8_t*>(found) - base) : -1;
+}
+
+/**
+ * @brief Frame de menor contador, a partir de nextVictim em ordem circular
+ *
+ * Um frame com o valor de lowestHint tem o menor contador. Se nenhum
+ * tiver, o menor valor e recalculado com a busca vetorial.
+ */
+int AgingAlgorithm::findVictim() {
+    int frame = findCounter(lowestHint);
+    if (frame < 0) {
+        lowestHint = minimum(counters.data(), counters.size());
+        frame = findCounter(lowestHint);
+    }
+    return frame;
+}
+
+/**
+ * @brief Nucleo do Aging, sem mensagens de debug
+ * @param pageNumber Numero da pagina a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+inline bool AgingAlgorithm::touchPage(int pageNumber) {
+    stats.totalReferences++;
+    bool fault;
+    
+    int frame = pageTable.find(pageNumber);
+    if (frame != -1) {
+        stats.hits++;
+        counters[frame] |= REFERENCED;
+        lastEvictedPage = -1;
+        fault = false;
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_HIT, "aging",
+                    stats.totalReferences, pageNumber, frame);
+    } else {
+        stats.pageFaults++;
+        
+        if (loadedFrames < memorySize) {
+            frame = loadedFrames++;
+            lastEvictedPage = -1;
+        } else {
+            frame = findVictim();
+            nextVictim = frame + 1 == memorySize ? 0 : frame + 1;
+            lastEvictedPage = pages[frame];
+            pageTable.erase(lastEvictedPage);
+        }
+        
+        pages[frame] = pageNumber;
+        counters[frame] = REFERENCED;
+        if (lowestHint > REFERENCED) {
+            lowestHint = REFERENCED;
+        }
+        pageTable.insert(pageNumber, frame);
+        fault = true;
+        
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_FAULT, "aging",
+                    stats.totalReferences, pageNumber, frame);
+        if (lastEvictedPage != -1) {
+            Logger::log(LogLevel::DEBUG, LogEventType::PAGE_EVICTED, "aging",
+                        stats.totalReferences, pageNumber, frame, lastEvictedPage);
+        }
+    }
+    
+    if (--untilTick == 0) {
+        shift(counters.data(), static_cast<size_t>(loadedFrames));
+        lowestHint >>= 1;
+        untilTick = tickInterval;
+        ticks++;
+    }
+    return fault;
+}
+
+/**
+ * @brief Processa um lote de referencias em um laco sem despacho virtual
+ */
+const AlgorithmStatistics& AgingAlgorithm::referencePages(const int* pages, size_t n,
+                                                          uint8_t* outHitMask) {
+    return replayBatch(pages, n, outHitMask,
+                       [this](int page) { return touchPage(page); });
+}
+
+/**
+ * @brief Referencia uma pagina
+ * @param pageNumber Numero da pagina a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+bool AgingAlgorithm::referencePage(int pageNumber) {
+    if (!debugMode) {
+        return touchPage(pageNumber);
+    }
+    
+    std::cout << "\n--- Referencia a pagina " << pageNumber << " ---\n";
+    
+    uint64_t ticksBefore = ticks;
+    bool fault = touchPage(pageNumber);
+    if (!fault) {
+        std::cout << "HIT: Pagina " << pageNumber << " marcada no bit mais alto do contador\n";
+    } else if (lastEvictedPage != -1) {
+        std::cout << "MISS: Substituindo pagina " << lastEvictedPage
+                  << " (menor contador) por " << pageNumber << "\n";
+    } else {
+        std::cout << "MISS: Pagina " << pageNumber << " carregada em frame vazio\n";
+    }
+    if (ticks != ticksBefore) {
+        std::cout << "Contadores deslocados (intervalo " << ticks << ")\n";
+    }
+    
+    displayMemoryState();
+    std::cout << "\n";
+    return fault;
+}
+
+/**
+ * @brief Exibe cada frame com sua pagina e seu contador (hexadecimal)
+ */
+void AgingAlgorithm::displayMemoryState() const {
+    std::cout << "Memoria: ";
+    
+    for (int i = 0; i < memorySize; ++i) {
+        if (i < loadedFrames) {
+            std::cout << "[" << std::setw(2) << pages[i] << ":" << std::hex << std::setw(2)
+                      << std::setfill('0') << static_cast<int>(counters[i])
+                      << std::dec << std::setfill(' ') << "] ";
+        } else {
+            std::cout << "[     ] ";
+        }
+    }
+    
+    displayStatistics();
+}
+
+/**
+ * @brief Implementacao do displayMemory para interface
+ */
+void AgingAlgorithm::displayMemory() const {
+    displayMemoryState();
+}
+
+/**
+ * @brief Reseta o algoritmo
+ */
+void AgingAlgorithm::reset() {
+    pages.assign(memorySize, -1);
+    counters.assign(memorySize, 0);
+    pageTable.clear();
+    loadedFrames = 0;
+    untilTick = tickInterval;
+    nextVictim = 0;
+    lowestHint = 0;
+    ticks = 0;
+    lastEvictedPage = -1;
+    stats.reset();
+    
+    if (debugMode) {
+        std::cout << "AgingAlgorithm resetado\n";
+    }
+}
+
+/**
+ * @brief Retorna as paginas atualmente na memoria
+ * @return Paginas na ordem dos frames
+ */
+std::vector<int> AgingAlgorithm::getCurrentPages() const {
+    return std::vector<int>(pages.begin(), pages.begin() + loadedFrames);
+}
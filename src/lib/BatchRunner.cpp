@@ -0,0 +1,1404 @@
+#include "../include/BatchRunner.h"
+#include "../include/TraceFile.h"
+#include "../include/SweepEngine.h"
+#include "../include/MissRatioCurve.h"
+#include "../include/WorkloadGenerator.h"
+#include "../include/SparsePageMap.h"
+#include "../include/FrameStore.h"
+#include "../include/ConcurrentClock.h"
+#include "../include/ShardedClock.h"
+#include "../include/TwoHandedClock.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <chrono>
+#include <cstdlib>
+#include <cerrno>
+#include <cctype>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+
+/**
+ * @brief Divide uma lista separada por virgulas
+ */
+static std::vector<std::string> splitList(const std::string& value) {
+    std::vector<std::string> items;
+    std::stringstream ss(value);
+    std::string item;
+    
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    
+    return items;
+}
+
+/**
+ * @brief Converte texto em inteiro positivo, lancando erro se invalido
+ */
+static int parsePositiveInt(const std::string& text, const std::string& option) {
+    char* end = nullptr;
+    errno = 0;
+    long value = std::strtol(text.c_str(), &end, 10);
+    
+    if (end == text.c_str() || *end != '\0' || errno == ERANGE || value <= 0 || value > 0x7fffffff) {
+        throw std::invalid_argument("Valor invalido para " + option + ": " + text);
+    }
+    
+    return static_cast<int>(value);
+}
+
+/**
+ * @brief Converte texto em inteiro positivo de 64 bits
+ */
+static int64_t parsePositiveInt64(const std::string& text, const std::string& option) {
+    char* end = nullptr;
+    errno = 0;
+    long long value = std::strtoll(text.c_str(), &end, 10);
+    
+    if (end == text.c_str() || *end != '\0' || errno == ERANGE || value <= 0) {
+        throw std::invalid_argument("Valor invalido para " + option + ": " + text);
+    }
+    
+    return static_cast<int64_t>(value);
+}
+
+/**
+ * @brief Escapa uma string para uso em JSON
+ */
+static std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default: escaped += c; break;
+        }
+    }
+    return escaped;
+}
+
+/**
+ * @brief Coloca um campo CSV entre aspas quando necessario
+ */
+static std::string csvField(const std::string& text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) {
+        return text;
+    }
+    
+    std::string quoted = "\"";
+    for (char c : text) {
+        quoted += c;
+        if (c == '"') quoted += '"';
+    }
+    return quoted + "\"";
+}
+
+/**
+ * @brief Exibe a ajuda do modo batch
+ */
+void BatchRunner::printUsage(std::ostream& os) {
+    os << "Uso: simulator [opcoes] [trace...]\n"
+       << "Sem argumentos, abre o menu interativo.\n\n"
+       << "Opcoes do modo batch:\n"
+       << "  --trace ARQUIVO        Trace de paginas (pode repetir). Texto: inteiros\n"
+       << "                         separados por espaco, '#' inicia comentario.\n"
+       << "                         Binario (PGTRACE): mapeado em memoria, sem copia\n"
+       << "  --algorithms LISTA     clock,second-chance,fifo,optimal,lru,aging,arc,car\n"
+       << "                         (padrao: todos)\n"
+       << "  --frames LISTA         Numeros de frames, ex.: 3,4,64 (padrao: 3)\n"
+       << "  --workload SPEC        Carga sintetica no lugar de um trace (pode repetir):\n"
+       << "                         tipo[:chave=valor,...], tipos uniform, zipf, scan,\n"
+       << "                         loop, phased; chaves length, pages, ws, phase,\n"
+       << "                         locality, alpha, seed. Ex.: zipf:pages=1e5,alpha=0.9\n"
+       << "  --virtual N            Paginas validas 0..N-1 (padrao: sem limite; IDs\n"
+       << "                         de ate 64 bits, traduzidos para IDs densos)\n"
+       << "  --format csv|json      Formato da saida (padrao: csv)\n"
+       << "  --output ARQUIVO       Grava a saida em arquivo (padrao: stdout)\n"
+       << "  --convert ARQUIVO      Converte o trace de texto para o formato binario\n"
+       << "  --import FORMATO       Traces sao de enderecos: lackey (valgrind\n"
+       << "                         --tool=lackey --trace-mem=yes), perf (perf mem\n"
+       << "                         report -D) ou raw (uint64 little-endian)\n"
+       << "  --page-size N          Tamanho da pagina do --import: 4K, 16K, 2M, ...\n"
+       << "                         (padrao: 4K)\n"
+       << "  --address-bits N       Bits significativos do endereco no --import\n"
+       << "                         (padrao: 64; ex.: 56 descarta tags no byte alto)\n"
+       << "  --stream               Le traces binarios em blocos numa thread de leitura\n"
+       << "                         (memoria constante; nao suporta optimal)\n"
+       << "  --chunk N              Paginas por bloco no modo --stream (padrao: 1048576)\n"
+       << "  --mrc N                Curvas LRU e OPT de page faults para 1..N frames,\n"
+       << "                         cada uma em uma unica passagem pelo trace\n"
+       << "                         (--algorithms lru e/ou optimal; sem --frames)\n"
+       << "  --threads N            Threads da varredura algoritmos x frames\n"
+       << "                         (padrao: numero de cores)\n"
+       << "  --concurrent           Replay concorrente: cada trace/carga e uma thread\n"
+       << "                         sobre o mesmo pool de frames (Clock com bits de\n"
+       << "                         referencia atomicos); uma linha por thread e o total\n"
+       << "  --shards N             Clock particionado: frames divididos em N shards\n"
+       << "                         (um Clock por shard, paginas por hash, shards\n"
+       << "                         repartidos entre --threads), comparado ao Clock\n"
+       << "                         global; uma linha por shard, o total e o global\n"
+       << "  --epoch N              Referencias entre migracoes de frames do shard\n"
+       << "                         com menos faults para o com mais (padrao: 65536;\n"
+       << "                         0 = cotas fixas)\n"
+       << "  --page-daemon MODO     Clock de dois ponteiros com reserva de frames livres\n"
+       << "                         reposta por um daemon: thread (em segundo plano) ou\n"
+       << "                         inline (no proprio fault); compara a latencia dos\n"
+       << "                         faults com a do Clock e mede o trabalho do daemon\n"
+       << "  --hand-spread N        Frames entre os ponteiros (padrao: metade da memoria)\n"
+       << "  --watermarks B,A       Reserva que acorda o daemon e em que ele para\n"
+       << "                         (padrao: frames/64 e frames/32)\n"
+       << "  --fuzz N               Fuzzing diferencial: N sequencias aleatorias e\n"
+       << "                         adversariais em Clock e Segunda Chance, comparando\n"
+       << "                         as decisoes a cada fault (sem traces; usa --frames\n"
+       << "                         se informado, senao 1..8). Codigo de saida 1 se\n"
+       << "                         divergirem; a sequencia e reduzida ao minimo\n"
+       << "  --fuzz-seed N          Semente do --fuzz (padrao: 1)\n"
+       << "  --log-level NIVEL      trace,debug,info,warn,error,off (padrao: off)\n"
+       << "  --log-file ARQUIVO     Grava o log em arquivo (padrao: stderr)\n"
+       << "  --help                 Exibe esta ajuda\n";
+}
+
+/**
+ * @brief Le as opcoes da linha de comando
+ * @return false se apenas a ajuda foi exibida
+ */
+bool BatchRunner::parseArguments(int argc, char* argv[]) {
+    config = BatchConfig();
+    
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        
+        if (arg == "--help" || arg == "-h") {
+            printUsage(std::cout);
+            return false;
+        }
+        
+        if (arg.compare(0, 2, "--") != 0) {
+            config.traceFiles.push_back(arg);
+            continue;
+        }
+        
+        if (arg == "--stream") {
+            config.streaming = true;
+            continue;
+        }
+        if (arg == "--concurrent") {
+            config.concurrent = true;
+            continue;
+        }
+        
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("Opcao " + arg + " requer um valor");
+        }
+        std::string value = argv[++i];
+        
+        if (arg == "--trace") {
+            config.traceFiles.push_back(value);
+        } else if (arg == "--workload") {
+            WorkloadGenerator::parseSpec(value);  // Valida antes de executar
+            config.workloads.push_back(value);
+        } else if (arg == "--algorithms") {
+            for (const auto& name : splitList(value)) {
+                ReplayPolicy policy;
+                if (!TraceReplay::parsePolicy(name, policy)) {
+                    throw std::invalid_argument("Algoritmo desconhecido: " + name);
+                }
+                config.policies.push_back(policy);
+            }
+        } else if (arg == "--frames") {
+            for (const auto& item : splitList(value)) {
+                config.frameCounts.push_back(parsePositiveInt(item, arg));
+            }
+        } else if (arg == "--virtual") {
+            config.virtualMemorySize = parsePositiveInt64(value, arg);
+        } else if (arg == "--format") {
+            if (value == "csv") {
+                config.format = OutputFormat::CSV;
+            } else if (value == "json") {
+                config.format = OutputFormat::JSON;
+            } else {
+                throw std::invalid_argument("Formato desconhecido: " + value);
+            }
+        } else if (arg == "--output") {
+            config.outputFile = value;
+        } else if (arg == "--convert") {
+            config.convertFile = value;
+        } else if (arg == "--import") {
+            if (!AddressTrace::parseFormat(value, config.addressOptions.format)) {
+                throw std::invalid_argument("Formato de enderecos desconhecido: " + value);
+            }
+            config.importAddresses = true;
+        } else if (arg == "--page-size") {
+            if (!AddressTrace::parsePageSize(value, config.addressOptions.pageSize)) {
+                throw std::invalid_argument("Tamanho de pagina invalido (potencia de 2 >= 512): " + value);
+            }
+        } else if (arg == "--address-bits") {
+            config.addressOptions.addressBits = parsePositiveInt(value, arg);
+            if (config.addressOptions.addressBits > 64) {
+                throw std::invalid_argument("Valor invalido para " + arg + ": " + value);
+            }
+        } else if (arg == "--mrc") {
+            config.curveFrames = parsePositiveInt(value, arg);
+        } else if (arg == "--fuzz") {
+            config.fuzzCases = static_cast<uint64_t>(parsePositiveInt64(value, arg));
+        } else if (arg == "--fuzz-seed") {
+            config.fuzzSeed = static_cast<uint64_t>(parsePositiveInt64(value, arg));
+        } else if (arg == "--shards") {
+            config.shards = parsePositiveInt(value, arg);
+        } else if (arg == "--epoch") {
+            config.epochLength = value == "0" ? 0 : static_cast<size_t>(parsePositiveInt64(value, arg));
+        } else if (arg == "--page-daemon") {
+            if (value != "thread" && value != "inline") {
+                throw std::invalid_argument("Modo do daemon desconhecido (thread ou inline): " + value);
+            }
+            config.pageDaemon = true;
+            config.daemonOptions.background = value == "thread";
+        } else if (arg == "--hand-spread") {
+            config.daemonOptions.handSpread = value == "0" ? 0 : parsePositiveInt(value, arg);
+        } else if (arg == "--watermarks") {
+            std::vector<std::string> marks = splitList(value);
+            if (marks.size() != 2) {
+                throw std::invalid_argument("--watermarks requer BAIXA,ALTA: " + value);
+            }
+            config.daemonOptions.lowWatermark = parsePositiveInt(marks[0], arg);
+            config.daemonOptions.highWatermark = parsePositiveInt(marks[1], arg);
+        } else if (arg == "--threads") {
+            config.threadCount = parsePositiveInt(value, arg);
+        } else if (arg == "--chunk") {
+            config.chunkSize = static_cast<size_t>(parsePositiveInt(value, arg));
+        } else if (arg == "--log-level") {
+            if (!Logger::parseLevel(value, config.logLevel)) {
+                throw std::invalid_argument("Nivel de log desconhecido: " + value);
+            }
+        } else if (arg == "--log-file") {
+            config.logFile = value;
+        } else {
+            throw std::invalid_argument("Opcao desconhecida: " + arg);
+        }
+    }
+    
+    if (config.fuzzCases > 0) {
+        if (!config.traceFiles.empty() || !config.workloads.empty() || !config.convertFile.empty() ||
+            config.streaming || config.curveFrames > 0 || config.concurrent || config.shards > 0 ||
+            config.pageDaemon) {
+            throw std::invalid_argument("--fuzz gera as proprias sequencias (sem traces, --stream ou --mrc)");
+        }
+        return true;
+    }
+    if (config.traceFiles.empty() && config.workloads.empty()) {
+        throw std::invalid_argument("Nenhum trace informado (use --trace ARQUIVO ou --workload SPEC)");
+    }
+    if (!config.convertFile.empty() && config.traceFiles.size() + config.workloads.size() != 1) {
+        throw std::invalid_argument("--convert requer exatamente um trace de entrada");
+    }
+    if (config.concurrent) {
+        if (config.streaming || config.curveFrames > 0 || !config.convertFile.empty()) {
+            throw std::invalid_argument("--concurrent nao e suportado com --stream, --mrc ou --convert");
+        }
+        for (ReplayPolicy policy : config.policies) {
+            if (policy != ReplayPolicy::CLOCK) {
+                throw std::invalid_argument("--concurrent suporta apenas o algoritmo clock");
+            }
+        }
+        config.policies.assign(1, ReplayPolicy::CLOCK);
+    }
+    if (config.shards > 0) {
+        if (config.streaming || config.curveFrames > 0 || !config.convertFile.empty() || config.concurrent) {
+            throw std::invalid_argument("--shards nao e suportado com --stream, --mrc, --convert ou --concurrent");
+        }
+        for (ReplayPolicy policy : config.policies) {
+            if (policy != ReplayPolicy::CLOCK) {
+                throw std::invalid_argument("--shards suporta apenas o algoritmo clock");
+            }
+        }
+        config.policies.assign(1, ReplayPolicy::CLOCK);
+    }
+    if (!config.pageDaemon && (config.daemonOptions.handSpread >= 0 || config.daemonOptions.lowWatermark > 0)) {
+        throw std::invalid_argument("--hand-spread e --watermarks requerem --page-daemon");
+    }
+    if (config.pageDaemon) {
+        if (config.streaming || config.curveFrames > 0 || !config.convertFile.empty() ||
+            config.concurrent || config.shards > 0) {
+            throw std::invalid_argument("--page-daemon nao e suportado com --stream, --mrc, --convert, "
+                                        "--concurrent ou --shards");
+        }
+        for (ReplayPolicy policy : config.policies) {
+            if (policy != ReplayPolicy::CLOCK) {
+                throw std::invalid_argument("--page-daemon suporta apenas o algoritmo clock");
+            }
+        }
+        config.policies.assign(1, ReplayPolicy::CLOCK);
+    }
+    if (config.curveFrames > 0) {
+        if (!config.frameCounts.empty()) {
+            throw std::invalid_argument("--frames nao se aplica a --mrc (a curva cobre 1..N frames)");
+        }
+        for (ReplayPolicy policy : config.policies) {
+            if (policy != ReplayPolicy::LRU && policy != ReplayPolicy::OPTIMAL) {
+                throw std::invalid_argument("--mrc suporta apenas os algoritmos lru e optimal");
+            }
+        }
+        if (config.policies.empty()) {
+            config.policies.push_back(ReplayPolicy::LRU);
+            config.policies.push_back(ReplayPolicy::OPTIMAL);
+        }
+    }
+    if (config.policies.empty()) {
+        config.policies = TraceReplay::getAllPolicies();
+        if (config.streaming) {
+            config.policies.erase(std::remove_if(config.policies.begin(), config.policies.end(),
+                [](ReplayPolicy p) { return !TraceReplay::supportsStreaming(p); }),
+                config.policies.end());
+        }
+    }
+    if (config.importAddresses && !config.workloads.empty()) {
+        throw std::invalid_argument("--import nao se aplica a --workload");
+    }
+    config.addressOptions.threadCount = config.threadCount;
+    if (config.streaming) {
+        if (config.importAddresses) {
+            throw std::invalid_argument("--import nao e suportado com --stream (use --convert antes)");
+        }
+        if (config.curveFrames > 0) {
+            throw std::invalid_argument("--mrc nao e suportado com --stream");
+        }
+        if (config.virtualMemorySize > 0) {
+            throw std::invalid_argument("--virtual nao e suportado com --stream");
+        }
+        for (ReplayPolicy policy : config.policies) {
+            if (!TraceReplay::supportsStreaming(policy)) {
+                throw std::invalid_argument("Algoritmo " + TraceReplay::getPolicyName(policy) +
+                                            " nao suporta --stream");
+            }
+        }
+    }
+    if (config.frameCounts.empty()) {
+        config.frameCounts.push_back(3);
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Carrega um trace de texto (inteiros de ate 64 bits separados por espaco)
+ */
+std::vector<int64_t> BatchRunner::loadTrace(const std::string& path) const {
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Nao foi possivel abrir o trace: " + path);
+    }
+    
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::vector<int64_t> pages;
+    const char* p = content.c_str();
+    
+    while (*p) {
+        if (*p == '#') {
+            while (*p && *p != '\n') ++p;
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(*p))) {
+            ++p;
+            continue;
+        }
+        
+        char* end = nullptr;
+        errno = 0;
+        long long page = std::strtoll(p, &end, 10);
+        if (end == p || errno == ERANGE) {
+            throw std::runtime_error("Trace invalido (" + path + "): esperado numero de pagina");
+        }
+        pages.push_back(static_cast<int64_t>(page));
+        p = end;
+    }
+    
+    return pages;
+}
+
+/**
+ * @brief IDs de pagina de um trace de texto ou, com --import, de um trace de enderecos
+ */
+std::vector<int64_t> BatchRunner::loadPageIds(const std::string& path) const {
+    if (!config.importAddresses) {
+        return loadTrace(path);
+    }
+    
+    AddressTraceImport imported = AddressTrace::import(path, config.addressOptions);
+    if (imported.skippedLines > 0) {
+        std::cerr << "Aviso: " << imported.skippedLines << " linhas nao reconhecidas em "
+                  << path << " (ignoradas)\n";
+    }
+    return std::move(imported.pages);
+}
+
+/**
+ * @brief Verifica se a pagina pertence ao espaco virtual configurado
+ */
+bool BatchRunner::isValidPage(int64_t page) const {
+    return page >= 0 && (config.virtualMemorySize == 0 || page < config.virtualMemorySize);
+}
+
+/**
+ * @brief Conta referencias fora do espaco virtual configurado
+ */
+uint64_t BatchRunner::countInvalidPages(const int* pages, size_t count) const {
+    uint64_t invalid = 0;
+    for (size_t i = 0; i < count; ++i) {
+        invalid += !isValidPage(pages[i]);
+    }
+    return invalid;
+}
+
+/**
+ * @brief Copia apenas as referencias validas
+ */
+std::vector<int> BatchRunner::copyValidPages(const int* pages, size_t count) const {
+    std::vector<int> valid;
+    valid.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (isValidPage(pages[i])) {
+            valid.push_back(pages[i]);
+        }
+    }
+    return valid;
+}
+
+/**
+ * @brief Filtra as referencias invalidas e traduz IDs de 64 bits para int
+ * @param invalid Recebe o numero de referencias descartadas
+ * 
+ * Se todos os IDs validos cabem nos frames (0..PackedFrame::MAX_PAGE),
+ * sao copiados como estao. Senao o trace inteiro passa pelo
+ * SparsePageMap (IDs densos na ordem do primeiro acesso); as politicas
+ * so comparam paginas por igualdade, entao os resultados nao mudam.
+ */
+std::vector<int> BatchRunner::compactPages(const int64_t* ids, size_t count, uint64_t& invalid) const {
+    bool sparse = false;
+    invalid = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!isValidPage(ids[i])) {
+            invalid++;
+        } else if (ids[i] > PackedFrame::MAX_PAGE) {
+            sparse = true;
+        }
+    }
+    
+    std::vector<int> pages;
+    pages.reserve(count - invalid);
+    SparsePageMap pageMap;
+    for (size_t i = 0; i < count; ++i) {
+        if (isValidPage(ids[i])) {
+            pages.push_back(sparse ? pageMap.intern(ids[i]) : static_cast<int>(ids[i]));
+        }
+    }
+    
+    return pages;
+}
+
+/**
+ * @brief Converte o trace de texto (ou de enderecos) informado para o formato binario
+ * 
+ * IDs negativos nao sao paginas e ficam fora do arquivo (com aviso). IDs
+ * acima de PackedFrame::MAX_PAGE geram um trace com IDs de 64 bits, que
+ * e traduzido para IDs densos na leitura.
+ */
+int BatchRunner::convertTrace() {
+    size_t count;
+    if (config.workloads.empty()) {
+        std::vector<int64_t> ids = loadPageIds(config.traceFiles.front());
+        size_t negative = ids.size();
+        ids.erase(std::remove_if(ids.begin(), ids.end(), [](int64_t id) { return id < 0; }), ids.end());
+        negative -= ids.size();
+        if (negative > 0) {
+            std::cerr << "Aviso: " << negative << " referencias com pagina negativa descartadas\n";
+        }
+        count = ids.size();
+        
+        bool wide = std::any_of(ids.begin(), ids.end(), [](int64_t id) {
+            return id > PackedFrame::MAX_PAGE;
+        });
+        if (wide) {
+            TraceFile::writeBinary(config.convertFile, ids.data(), count);
+        } else {
+            std::vector<int> pages(ids.begin(), ids.end());
+            TraceFile::writeBinary(config.convertFile, pages.data(), count);
+        }
+    } else {
+        std::vector<int> pages = WorkloadGenerator::materialize(
+            WorkloadGenerator::parseSpec(config.workloads.front()));
+        count = pages.size();
+        TraceFile::writeBinary(config.convertFile, pages.data(), count);
+    }
+    
+    std::cerr << "Trace convertido: " << count << " referencias -> "
+              << config.convertFile << "\n";
+    return 0;
+}
+
+/**
+ * @brief Executa todas as combinacoes trace x frames x algoritmo
+ * @return Codigo de saida do processo
+ */
+int BatchRunner::run() {
+    if (!config.convertFile.empty()) {
+        return convertTrace();
+    }
+    
+    results.clear();
+    curves.clear();
+    fuzzReport = FuzzReport();
+    concurrentResults.clear();
+    shardedResults.clear();
+    daemonResults.clear();
+    
+    // Eventos sao formatados numa thread propria; o log e encerrado ao sair
+    ScopedLogger logger(config.logLevel, config.logFile);
+    
+    if (config.fuzzCases > 0) {
+        runFuzz();
+    } else if (config.concurrent) {
+        runConcurrent();
+    } else {
+        for (const auto& traceFile : config.traceFiles) {
+            if (config.streaming) {
+                runStreaming(traceFile);
+                continue;
+            }
+            
+            MappedTrace mapped;
+            std::vector<int> loaded;
+            size_t count;
+            uint64_t invalid;
+            const int* pages = openTrace(traceFile, mapped, loaded, count, invalid);
+            
+            if (config.curveFrames > 0) {
+                runCurves(traceFile, pages, count);
+                continue;
+            }
+            if (config.shards > 0) {
+                runSharded(traceFile, pages, count, invalid);
+                continue;
+            }
+            if (config.pageDaemon) {
+                runPageDaemon(traceFile, pages, count, invalid);
+                continue;
+            }
+            
+            runSweep(traceFile, pages, count, invalid);
+        }
+        
+        for (const auto& spec : config.workloads) {
+            if (config.streaming) {
+                runStreamingWorkload(spec);
+                continue;
+            }
+            
+            std::vector<int> pages = WorkloadGenerator::materialize(WorkloadGenerator::parseSpec(spec));
+            uint64_t invalid = 0;
+            if (config.virtualMemorySize > 0) {
+                invalid = countInvalidPages(pages.data(), pages.size());
+                if (invalid > 0) {
+                    pages = copyValidPages(pages.data(), pages.size());
+                }
+            }
+            
+            if (config.curveFrames > 0) {
+                runCurves(spec, pages.data(), pages.size());
+                continue;
+            }
+            if (config.shards > 0) {
+                runSharded(spec, pages.data(), pages.size(), invalid);
+                continue;
+            }
+            if (config.pageDaemon) {
+                runPageDaemon(spec, pages.data(), pages.size(), invalid);
+                continue;
+            }
+            runSweep(spec, pages.data(), pages.size(), invalid);
+        }
+    }
+    
+    // Divergencia no --fuzz falha o processo (uso como verificacao de release)
+    int status = fuzzReport.diverged ? 1 : 0;
+    
+    if (config.outputFile.empty()) {
+        writeOutput(std::cout);
+        return status;
+    }
+    
+    std::ofstream output(config.outputFile.c_str());
+    if (!output) {
+        throw std::runtime_error("Nao foi possivel criar o arquivo: " + config.outputFile);
+    }
+    writeOutput(output);
+    return status;
+}
+
+/**
+ * @brief Fuzzing diferencial entre Clock e Segunda Chance (--fuzz)
+ */
+void BatchRunner::runFuzz() {
+    FuzzOptions options;
+    options.cases = config.fuzzCases;
+    options.seed = config.fuzzSeed;
+    options.threadCount = config.threadCount;
+    options.frameCounts = config.frameCounts;
+    
+    DifferentialFuzzer fuzzer(options);
+    fuzzReport = fuzzer.run();
+}
+
+/**
+ * @brief Carrega um trace com IDs compartilhados entre as threads
+ * 
+ * Todas as threads usam o mesmo pool de frames, entao a mesma pagina
+ * precisa do mesmo ID denso em todos os traces: os IDs passam por um
+ * unico SparsePageMap.
+ */
+void BatchRunner::internTrace(const std::string& traceFile, SparsePageMap& pageMap,
+                              std::vector<int>& pages, uint64_t& invalid) const {
+    std::vector<int64_t> ids;
+    if (!config.importAddresses && TraceFile::isBinaryTrace(traceFile)) {
+        MappedTrace mapped(traceFile);
+        if (mapped.isWide()) {
+            ids.assign(mapped.wideData(), mapped.wideData() + mapped.size());
+        } else {
+            ids.assign(mapped.data(), mapped.data() + mapped.size());
+        }
+    } else {
+        ids = loadPageIds(traceFile);
+    }
+    
+    pages.clear();
+    pages.reserve(ids.size());
+    invalid = 0;
+    for (int64_t id : ids) {
+        if (isValidPage(id)) {
+            pages.push_back(pageMap.intern(id));
+        } else {
+            invalid++;
+        }
+    }
+}
+
+/**
+ * @brief Replay concorrente de todos os traces sobre um Clock compartilhado
+ * 
+ * Cada trace (ou carga sintetica) e referenciado por uma thread propria,
+ * todas sobre o mesmo pool de frames, para cada numero de frames.
+ */
+void BatchRunner::runConcurrent() {
+    SparsePageMap pageMap;
+    std::vector<std::vector<int>> traces;
+    std::vector<std::string> names;
+    uint64_t invalid = 0;
+    
+    for (const auto& traceFile : config.traceFiles) {
+        uint64_t traceInvalid;
+        traces.push_back(std::vector<int>());
+        internTrace(traceFile, pageMap, traces.back(), traceInvalid);
+        names.push_back(traceFile);
+        invalid += traceInvalid;
+    }
+    for (const auto& spec : config.workloads) {
+        std::vector<int> generated = WorkloadGenerator::materialize(WorkloadGenerator::parseSpec(spec));
+        traces.push_back(std::vector<int>());
+        traces.back().reserve(generated.size());
+        for (int page : generated) {
+            if (isValidPage(page)) {
+                traces.back().push_back(pageMap.intern(page));
+            } else {
+                invalid++;
+            }
+        }
+        names.push_back(spec);
+    }
+    
+    std::vector<const int*> views;
+    std::vector<size_t> counts;
+    for (const auto& trace : traces) {
+        views.push_back(trace.data());
+        counts.push_back(trace.size());
+    }
+    int pageCount = std::max<int>(1, static_cast<int>(pageMap.size()));
+    int threadCount = static_cast<int>(traces.size());
+    
+    for (int frames : config.frameCounts) {
+        ConcurrentClock clock(frames, pageCount, threadCount);
+        
+        ConcurrentResult result;
+        result.traceFiles = names;
+        result.frames = frames;
+        result.invalidReferences = invalid;
+        result.wallSeconds = clock.replay(views, counts);
+        for (int t = 0; t < threadCount; ++t) {
+            result.threadStats.push_back(clock.getThreadStatistics(t));
+        }
+        result.stats = clock.getStatistics();
+        concurrentResults.push_back(result);
+    }
+}
+
+/**
+ * @brief Clock particionado em shards e Clock global sobre o mesmo trace
+ * 
+ * Para cada numero de frames, o ShardedClock (shards repartidos entre
+ * as threads) e um ClockAlgorithm com o mesmo total de frames; os page
+ * faults mostram o quanto a particao se afasta da politica global.
+ */
+void BatchRunner::runSharded(const std::string& traceFile, const int* pages, size_t count, uint64_t invalid) {
+    ShardOptions options;
+    options.shards = config.shards;
+    options.threadCount = config.threadCount;
+    options.epochLength = config.epochLength;
+    
+    for (int frames : config.frameCounts) {
+        ShardedClock sharded(frames, options);
+        
+        ShardedResult result;
+        result.traceFile = traceFile;
+        result.frames = frames;
+        result.invalidReferences = invalid;
+        result.wallSeconds = sharded.replay(pages, count);
+        for (int s = 0; s < sharded.getShardCount(); ++s) {
+            result.shardStats.push_back(sharded.getShardStatistics(s));
+        }
+        result.stats = sharded.getStatistics();
+        result.migratedFrames = sharded.getMigratedFrames();
+        
+        ClockAlgorithm global(frames, false);
+        auto start = std::chrono::steady_clock::now();
+        result.globalStats = global.referencePages(pages, count);
+        auto end = std::chrono::steady_clock::now();
+        result.globalSeconds = std::chrono::duration<double>(end - start).count();
+        
+        shardedResults.push_back(result);
+    }
+}
+
+/**
+ * @brief Clock de dois ponteiros com daemon e o Clock sincrono sobre o mesmo trace
+ * 
+ * As paginas sao traduzidas para IDs densos (os indices do Clock de dois
+ * ponteiros sao vetores diretos). O tempo do Clock vem de uma passagem
+ * sem medicao; a latencia dos seus faults, de uma segunda passagem que
+ * cronometra cada referencia.
+ */
+void BatchRunner::runPageDaemon(const std::string& traceFile, const int* pages, size_t count,
+                                uint64_t invalid) {
+    SparsePageMap pageMap;
+    std::vector<int> dense(count);
+    for (size_t i = 0; i < count; ++i) {
+        dense[i] = pageMap.intern(pages[i]);
+    }
+    int pageCount = std::max<int>(1, static_cast<int>(pageMap.size()));
+    
+    for (int frames : config.frameCounts) {
+        DaemonResult clockResult;
+        clockResult.traceFile = traceFile;
+        clockResult.algorithm = "clock";
+        clockResult.frames = frames;
+        clockResult.invalidReferences = invalid;
+        clockResult.handSpread = 0;
+        clockResult.lowWatermark = 0;
+        clockResult.highWatermark = 0;
+        clockResult.stalls = 0;
+        
+        ClockAlgorithm clock(frames, false);
+        auto start = std::chrono::steady_clock::now();
+        clockResult.stats = clock.referencePages(dense.data(), count);
+        auto end = std::chrono::steady_clock::now();
+        clockResult.wallSeconds = std::chrono::duration<double>(end - start).count();
+        
+        clock.reset();
+        for (size_t i = 0; i < count; ++i) {
+            auto begin = std::chrono::steady_clock::now();
+            bool fault = clock.referencePage(dense[i]);
+            auto done = std::chrono::steady_clock::now();
+            if (fault) {
+                clockResult.faultLatency.record(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(done - begin).count()));
+            }
+        }
+        daemonResults.push_back(clockResult);
+        
+        TwoHandedClock twoHanded(frames, pageCount, config.daemonOptions);
+        
+        DaemonResult result;
+        result.traceFile = traceFile;
+        result.algorithm = config.daemonOptions.background ? "two-handed" : "two-handed-inline";
+        result.frames = frames;
+        result.invalidReferences = invalid;
+        result.handSpread = twoHanded.getHandSpread();
+        result.lowWatermark = twoHanded.getLowWatermark();
+        result.highWatermark = twoHanded.getHighWatermark();
+        result.wallSeconds = twoHanded.replay(dense.data(), count);
+        result.stats = twoHanded.getStatistics();
+        result.faultLatency = twoHanded.getFaultLatency();
+        result.stalls = twoHanded.getStalls();
+        result.daemon = twoHanded.getDaemonStatistics();
+        daemonResults.push_back(result);
+    }
+}
+
+/**
+ * @brief Executa a varredura algoritmos x frames sobre um trace em memoria
+ */
+void BatchRunner::runSweep(const std::string& traceFile, const int* pages, size_t count, uint64_t invalid) {
+    // Todas as combinacoes compartilham a mesma visao do trace
+    SweepEngine engine(config.threadCount);
+    SweepMatrix matrix = engine.run(pages, count, config.policies, config.frameCounts);
+    
+    for (size_t f = 0; f < config.frameCounts.size(); ++f) {
+        for (size_t p = 0; p < config.policies.size(); ++p) {
+            const SweepResult& cell = matrix.at(p, f);
+            
+            BatchResult result;
+            result.traceFile = traceFile;
+            result.policy = cell.policy;
+            result.frames = cell.frames;
+            result.invalidReferences = invalid;
+            result.stats = cell.stats;
+            result.wallSeconds = cell.wallSeconds;
+            result.targetHistory = cell.targetHistory;
+            results.push_back(result);
+        }
+    }
+}
+
+/**
+ * @brief Abre um trace (binario mapeado ou texto) e filtra paginas invalidas
+ * @return Ponteiro para as paginas; valido enquanto mapped/loaded existirem
+ */
+const int* BatchRunner::openTrace(const std::string& traceFile, MappedTrace& mapped,
+                                  std::vector<int>& loaded, size_t& count, uint64_t& invalid) const {
+    // Traces binarios de 32 bits sao usados direto do mapeamento; texto e
+    // binarios de 64 bits sao validados e traduzidos para int em memoria
+    if (!config.importAddresses && TraceFile::isBinaryTrace(traceFile)) {
+        mapped.open(traceFile);
+        if (mapped.isWide()) {
+            loaded = compactPages(mapped.wideData(), mapped.size(), invalid);
+            count = loaded.size();
+            return loaded.data();
+        }
+    } else {
+        std::vector<int64_t> ids = loadPageIds(traceFile);
+        loaded = compactPages(ids.data(), ids.size(), invalid);
+        count = loaded.size();
+        return loaded.data();
+    }
+    
+    const int* pages = mapped.data();
+    count = mapped.size();
+    
+    // Uma passagem confirma que todos os IDs sao paginas validas que cabem
+    // nos frames; senao o trace passa pelo mesmo filtro do texto
+    invalid = 0;
+    bool inRange = std::all_of(pages, pages + count, [this](int page) {
+        return isValidPage(page) && page <= PackedFrame::MAX_PAGE;
+    });
+    if (!inRange) {
+        std::vector<int64_t> ids(pages, pages + count);
+        loaded = compactPages(ids.data(), ids.size(), invalid);
+        pages = loaded.data();
+        count = loaded.size();
+    }
+    
+    return pages;
+}
+
+/**
+ * @brief Calcula as curvas LRU e/ou OPT de 1..curveFrames frames em uma passagem cada
+ */
+void BatchRunner::runCurves(const std::string& traceFile, const int* pages, size_t count) {
+    MissRatioCurve curve(config.curveFrames);
+    
+    for (ReplayPolicy policy : config.policies) {
+        auto start = std::chrono::steady_clock::now();
+        
+        CurveResult result;
+        result.traceFile = traceFile;
+        result.algorithm = TraceReplay::getPolicyName(policy);
+        result.references = count;
+        result.faults = policy == ReplayPolicy::LRU ? curve.computeLRU(pages, count)
+                                                    : curve.computeOptimal(pages, count);
+        
+        auto end = std::chrono::steady_clock::now();
+        result.wallSeconds = std::chrono::duration<double>(end - start).count();
+        curves.push_back(result);
+    }
+}
+
+/**
+ * @brief Executa as combinacoes lendo o trace em streaming
+ * 
+ * Todas as combinacoes consomem os mesmos blocos (ReplayEngine): o
+ * arquivo e lido uma unica vez e a memoria usada fica em 2 * chunkSize
+ * paginas, independente do tamanho do trace.
+ */
+void BatchRunner::runStreaming(const std::string& traceFile) {
+    if (!TraceFile::isBinaryTrace(traceFile)) {
+        throw std::invalid_argument("--stream requer trace binario (use --convert): " + traceFile);
+    }
+    
+    ReplayEngine engine;
+    addCombinations(engine);
+    TraceStream stream(traceFile, config.chunkSize);
+    engine.runChunks(stream);
+    collectResults(traceFile, engine, stream.getInvalidReferences());
+}
+
+/**
+ * @brief Executa uma carga sintetica gerada bloco a bloco (sem materializar)
+ * 
+ * A carga e gerada uma unica vez para todas as combinacoes.
+ */
+void BatchRunner::runStreamingWorkload(const std::string& spec) {
+    ReplayEngine engine;
+    addCombinations(engine);
+    WorkloadGenerator generator(WorkloadGenerator::parseSpec(spec), config.chunkSize);
+    engine.runChunks(generator);
+    collectResults(spec, engine, 0);
+}
+
+/**
+ * @brief Registra no engine cada combinacao frames x algoritmo
+ */
+void BatchRunner::addCombinations(ReplayEngine& engine) const {
+    for (int frames : config.frameCounts) {
+        for (ReplayPolicy policy : config.policies) {
+            engine.addPolicy(policy, frames);
+        }
+    }
+}
+
+/**
+ * @brief Copia para os resultados as estatisticas de cada combinacao do engine
+ */
+void BatchRunner::collectResults(const std::string& traceFile, const ReplayEngine& engine,
+                                 uint64_t invalid) {
+    for (size_t i = 0; i < engine.size(); ++i) {
+        BatchResult result;
+        result.traceFile = traceFile;
+        result.policy = engine.getPolicy(i);
+        result.frames = engine.getFrames(i);
+        result.invalidReferences = invalid;
+        result.stats = engine.getStatistics(i);
+        result.wallSeconds = engine.getSeconds(i);
+        if (const TargetHistory* history = engine.getTargetHistory(i)) {
+            result.targetHistory = history->getSamples();
+        }
+        results.push_back(result);
+    }
+}
+
+/**
+ * @brief Emite os resultados no formato configurado
+ */
+void BatchRunner::writeOutput(std::ostream& os) const {
+    if (config.fuzzCases > 0) {
+        config.format == OutputFormat::JSON ? writeFuzzJson(os) : writeFuzzCsv(os);
+    } else if (config.concurrent) {
+        config.format == OutputFormat::JSON ? writeConcurrentJson(os) : writeConcurrentCsv(os);
+    } else if (config.shards > 0) {
+        config.format == OutputFormat::JSON ? writeShardedJson(os) : writeShardedCsv(os);
+    } else if (config.pageDaemon) {
+        config.format == OutputFormat::JSON ? writeDaemonJson(os) : writeDaemonCsv(os);
+    } else if (config.curveFrames > 0) {
+        config.format == OutputFormat::JSON ? writeCurveJson(os) : writeCurveCsv(os);
+    } else {
+        config.format == OutputFormat::JSON ? writeJson(os) : writeCsv(os);
+    }
+}
+
+/**
+ * @brief Emite os resultados em CSV (uma linha por execucao)
+ */
+void BatchRunner::writeCsv(std::ostream& os) const {
+    os << "trace,algorithm,frames,references,invalid_references,page_faults,hits,"
+       << "hit_rate,wall_time_s,references_per_second\n";
+    
+    for (const auto& r : results) {
+        os << csvField(r.traceFile) << ','
+           << TraceReplay::getPolicyName(r.policy) << ','
+           << r.frames << ','
+           << r.stats.totalReferences << ','
+           << r.invalidReferences << ','
+           << r.stats.pageFaults << ','
+           << r.stats.hits << ','
+           << std::fixed << std::setprecision(4) << r.stats.getHitRate() << ','
+           << std::setprecision(9) << r.wallSeconds << ','
+           << std::setprecision(1) << r.getReferencesPerSecond() << '\n';
+    }
+}
+
+/**
+ * @brief Emite os resultados em JSON
+ */
+void BatchRunner::writeJson(std::ostream& os) const {
+    os << "{\n  \"results\": [\n";
+    
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        os << "    {"
+           << "\"trace\": \"" << jsonEscape(r.traceFile) << "\", "
+           << "\"algorithm\": \"" << TraceReplay::getPolicyName(r.policy) << "\", "
+           << "\"frames\": " << r.frames << ", "
+           << "\"references\": " << r.stats.totalReferences << ", "
+           << "\"invalid_references\": " << r.invalidReferences << ", "
+           << "\"page_faults\": " << r.stats.pageFaults << ", "
+           << "\"hits\": " << r.stats.hits << ", "
+           << "\"hit_rate\": " << std::fixed << std::setprecision(4) << r.stats.getHitRate() << ", "
+           << "\"wall_time_s\": " << std::setprecision(9) << r.wallSeconds << ", "
+           << "\"references_per_second\": " << std::setprecision(1) << r.getReferencesPerSecond();
+        
+        // ARC e CAR: [referencia, p] a intervalos regulares do replay
+        if (!r.targetHistory.empty()) {
+            os << ", \"target_history\": [";
+            for (size_t s = 0; s < r.targetHistory.size(); ++s) {
+                os << (s > 0 ? ", " : "") << "[" << r.targetHistory[s].step << ", "
+                   << r.targetHistory[s].target << "]";
+            }
+            os << "]";
+        }
+        os << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    
+    os << "  ]\n}\n";
+}
+
+/**
+ * @brief Emite as curvas em CSV (uma linha por tamanho de memoria)
+ */
+void BatchRunner::writeCurveCsv(std::ostream& os) const {
+    os << "trace,algorithm,frames,references,page_faults,miss_ratio\n";
+    
+    for (const auto& curve : curves) {
+        for (size_t c = 0; c < curve.faults.size(); ++c) {
+            double ratio = curve.references > 0 ? (double)curve.faults[c] / curve.references : 0.0;
+            os << csvField(curve.traceFile) << ',' << curve.algorithm << ',' << (c + 1) << ','
+               << curve.references << ',' << curve.faults[c] << ','
+               << std::fixed << std::setprecision(6) << ratio << '\n';
+        }
+    }
+}
+
+/**
+ * @brief Emite as curvas em JSON (vetor de page faults por curva)
+ */
+void BatchRunner::writeCurveJson(std::ostream& os) const {
+    os << "{\n  \"curves\": [\n";
+    
+    for (size_t i = 0; i < curves.size(); ++i) {
+        const auto& curve = curves[i];
+        os << "    {"
+           << "\"trace\": \"" << jsonEscape(curve.traceFile) << "\", "
+           << "\"algorithm\": \"" << curve.algorithm << "\", "
+           << "\"references\": " << curve.references << ", "
+           << "\"wall_time_s\": " << std::fixed << std::setprecision(9) << curve.wallSeconds << ", "
+           << "\"page_faults\": [";
+        
+        for (size_t c = 0; c < curve.faults.size(); ++c) {
+            os << (c > 0 ? ", " : "") << curve.faults[c];
+        }
+        
+        os << "]}" << (i + 1 < curves.size() ? "," : "") << "\n";
+    }
+    
+    os << "  ]\n}\n";
+}
+
+/**
+ * @brief Emite o resultado do --fuzz em CSV (uma linha)
+ * 
+ * Em caso de divergencia, case reproduz a sequencia original com a
+ * mesma semente; frames e sequence sao os da sequencia minimizada.
+ */
+void BatchRunner::writeFuzzCsv(std::ostream& os) const {
+    const FuzzDivergence& d = fuzzReport.divergence;
+    os << "seed,cases,references,diverged,case,frames,sequence,reason,"
+       << "wall_time_s,cases_per_second\n";
+    
+    os << config.fuzzSeed << ',' << fuzzReport.cases << ',' << fuzzReport.references << ','
+       << (fuzzReport.diverged ? 1 : 0) << ',';
+    if (fuzzReport.diverged) {
+        std::string sequence;
+        for (size_t i = 0; i < d.minimized.size(); ++i) {
+            sequence += (i > 0 ? " " : "") + std::to_string(d.minimized[i]);
+        }
+        os << d.caseIndex << ',' << d.minimizedFrames << ',' << sequence << ','
+           << csvField(d.reason) << ',';
+    } else {
+        os << ",,,,";
+    }
+    os << std::fixed << std::setprecision(9) << fuzzReport.wallSeconds << ','
+       << std::setprecision(1) << fuzzReport.getCasesPerSecond() << '\n';
+}
+
+/**
+ * @brief Emite o resultado do --fuzz em JSON
+ */
+void BatchRunner::writeFuzzJson(std::ostream& os) const {
+    const FuzzDivergence& d = fuzzReport.divergence;
+    os << "{\n  \"fuzz\": {"
+       << "\"seed\": " << config.fuzzSeed << ", "
+       << "\"cases\": " << fuzzReport.cases << ", "
+       << "\"references\": " << fuzzReport.references << ", "
+       << "\"diverged\": " << (fuzzReport.diverged ? "true" : "false") << ", "
+       << "\"wall_time_s\": " << std::fixed << std::setprecision(9) << fuzzReport.wallSeconds << ", "
+       << "\"cases_per_second\": " << std::setprecision(1) << fuzzReport.getCasesPerSecond();
+    
+    if (fuzzReport.diverged) {
+        os << ",\n    \"divergence\": {"
+           << "\"case\": " << d.caseIndex << ", "
+           << "\"case_frames\": " << d.frames << ", "
+           << "\"case_length\": " << d.sequence.size() << ", "
+           << "\"frames\": " << d.minimizedFrames << ", "
+           << "\"step\": " << d.step << ", "
+           << "\"reason\": \"" << jsonEscape(d.reason) << "\", "
+           << "\"sequence\": [";
+        for (size_t i = 0; i < d.minimized.size(); ++i) {
+            os << (i > 0 ? ", " : "") << d.minimized[i];
+        }
+        os << "]}";
+    }
+    
+    os << "}\n}\n";
+}
+
+/**
+ * @brief Emite o replay concorrente em CSV
+ * 
+ * Uma linha por thread e uma linha "all" com a soma; o tempo de parede
+ * e o mesmo para todas (as threads rodam juntas).
+ */
+void BatchRunner::writeConcurrentCsv(std::ostream& os) const {
+    os << "trace,thread,frames,references,page_faults,hits,hit_rate,"
+       << "wall_time_s,references_per_second\n";
+    
+    for (const auto& r : concurrentResults) {
+        for (size_t t = 0; t <= r.threadStats.size(); ++t) {
+            bool total = t == r.threadStats.size();
+            const AlgorithmStatistics& stats = total ? r.stats : r.threadStats[t];
+            double perSecond = r.wallSeconds > 0.0 ? stats.totalReferences / r.wallSeconds : 0.0;
+            
+            os << (total ? std::string("all") : csvField(r.traceFiles[t])) << ','
+               << (total ? std::string("all") : std::to_string(t)) << ','
+               << r.frames << ','
+               << stats.totalReferences << ','
+               << stats.pageFaults << ','
+               << stats.hits << ','
+               << std::fixed << std::setprecision(4) << stats.getHitRate() << ','
+               << std::setprecision(9) << r.wallSeconds << ','
+               << std::setprecision(1) << perSecond << '\n';
+        }
+    }
+}
+
+/**
+ * @brief Emite o replay concorrente em JSON
+ */
+void BatchRunner::writeConcurrentJson(std::ostream& os) const {
+    os << "{\n  \"concurrent\": [\n";
+    
+    for (size_t i = 0; i < concurrentResults.size(); ++i) {
+        const auto& r = concurrentResults[i];
+        os << "    {"
+           << "\"frames\": " << r.frames << ", "
+           << "\"threads\": " << r.threadStats.size() << ", "
+           << "\"invalid_references\": " << r.invalidReferences << ", "
+           << "\"references\": " << r.stats.totalReferences << ", "
+           << "\"page_faults\": " << r.stats.pageFaults << ", "
+           << "\"hits\": " << r.stats.hits << ", "
+           << "\"hit_rate\": " << std::fixed << std::setprecision(4) << r.stats.getHitRate() << ", "
+           << "\"wall_time_s\": " << std::setprecision(9) << r.wallSeconds << ", "
+           << "\"references_per_second\": " << std::setprecision(1)
+           << (r.wallSeconds > 0.0 ? r.stats.totalReferences / r.wallSeconds : 0.0) << ", "
+           << "\"per_thread\": [";
+        
+        for (size_t t = 0; t < r.threadStats.size(); ++t) {
+            const AlgorithmStatistics& stats = r.threadStats[t];
+            os << (t > 0 ? ", " : "")
+               << "{\"trace\": \"" << jsonEscape(r.traceFiles[t]) << "\", "
+               << "\"references\": " << stats.totalReferences << ", "
+               << "\"page_faults\": " << stats.pageFaults << ", "
+               << "\"hits\": " << stats.hits << "}";
+        }
+        
+        os << "]}" << (i + 1 < concurrentResults.size() ? "," : "") << "\n";
+    }
+    
+    os << "  ]\n}\n";
+}
+
+/**
+ * @brief Emite o Clock particionado em CSV
+ * 
+ * Uma linha por shard (frames = cota final), uma linha "all" com a soma
+ * (frames_received = frames_donated = frames migrados) e uma linha
+ * "global" com o Clock de um unico ponteiro. Os shards compartilham o
+ * tempo de parede do replay.
+ */
+void BatchRunner::writeShardedCsv(std::ostream& os) const {
+    os << "trace,shard,frames,references,page_faults,hits,hit_rate,"
+       << "frames_received,frames_donated,wall_time_s,references_per_second\n";
+    
+    for (const auto& r : shardedResults) {
+        size_t shardCount = r.shardStats.size();
+        for (size_t s = 0; s <= shardCount + 1; ++s) {
+            bool total = s == shardCount;
+            bool global = s == shardCount + 1;
+            const AlgorithmStatistics& stats = global ? r.globalStats
+                                             : total ? r.stats : r.shardStats[s].stats;
+            double seconds = global ? r.globalSeconds : r.wallSeconds;
+            double perSecond = seconds > 0.0 ? stats.totalReferences / seconds : 0.0;
+            uint64_t received = global ? 0 : total ? r.migratedFrames : r.shardStats[s].framesReceived;
+            uint64_t donated = global ? 0 : total ? r.migratedFrames : r.shardStats[s].framesDonated;
+            
+            os << csvField(r.traceFile) << ','
+               << (global ? std::string("global") : total ? std::string("all") : std::to_string(s)) << ','
+               << (global || total ? r.frames : r.shardStats[s].frames) << ','
+               << stats.totalReferences << ','
+               << stats.pageFaults << ','
+               << stats.hits << ','
+               << std::fixed << std::setprecision(4) << stats.getHitRate() << ','
+               << received << ','
+               << donated << ','
+               << std::setprecision(9) << seconds << ','
+               << std::setprecision(1) << perSecond << '\n';
+        }
+    }
+}
+
+/**
+ * @brief Emite o Clock particionado em JSON
+ */
+void BatchRunner::writeShardedJson(std::ostream& os) const {
+    os << "{\n  \"sharded\": [\n";
+    
+    for (size_t i = 0; i < shardedResults.size(); ++i) {
+        const auto& r = shardedResults[i];
+        os << "    {"
+           << "\"trace\": \"" << jsonEscape(r.traceFile) << "\", "
+           << "\"frames\": " << r.frames << ", "
+           << "\"shards\": " << r.shardStats.size() << ", "
+           << "\"invalid_references\": " << r.invalidReferences << ", "
+           << "\"references\": " << r.stats.totalReferences << ", "
+           << "\"page_faults\": " << r.stats.pageFaults << ", "
+           << "\"hits\": " << r.stats.hits << ", "
+           << "\"hit_rate\": " << std::fixed << std::setprecision(4) << r.stats.getHitRate() << ", "
+           << "\"migrated_frames\": " << r.migratedFrames << ", "
+           << "\"wall_time_s\": " << std::setprecision(9) << r.wallSeconds << ", "
+           << "\"references_per_second\": " << std::setprecision(1)
+           << (r.wallSeconds > 0.0 ? r.stats.totalReferences / r.wallSeconds : 0.0) << ", "
+           << "\"global\": {"
+           << "\"page_faults\": " << r.globalStats.pageFaults << ", "
+           << "\"hits\": " << r.globalStats.hits << ", "
+           << "\"hit_rate\": " << std::setprecision(4) << r.globalStats.getHitRate() << ", "
+           << "\"wall_time_s\": " << std::setprecision(9) << r.globalSeconds << ", "
+           << "\"references_per_second\": " << std::setprecision(1)
+           << (r.globalSeconds > 0.0 ? r.globalStats.totalReferences / r.globalSeconds : 0.0) << "}, "
+           << "\"fault_difference_pct\": " << std::setprecision(4) << r.getFaultDifference() << ", "
+           << "\"per_shard\": [";
+        
+        for (size_t s = 0; s < r.shardStats.size(); ++s) {
+            const ShardStatistics& shard = r.shardStats[s];
+            os << (s > 0 ? ", " : "")
+               << "{\"frames\": " << shard.frames << ", "
+               << "\"references\": " << shard.stats.totalReferences << ", "
+               << "\"page_faults\": " << shard.stats.pageFaults << ", "
+               << "\"hits\": " << shard.stats.hits << ", "
+               << "\"frames_received\": " << shard.framesReceived << ", "
+               << "\"frames_donated\": " << shard.framesDonated << "}";
+        }
+        
+        os << "]}" << (i + 1 < shardedResults.size() ? "," : "") << "\n";
+    }
+    
+    os << "  ]\n}\n";
+}
+
+/**
+ * @brief Emite a comparacao Clock x Clock de dois ponteiros em CSV
+ * 
+ * Latencias em nanossegundos, medidas na thread da aplicacao (percentis
+ * com erro de ate 25%); as colunas daemon_* sao o trabalho do daemon,
+ * fora da latencia quando ele roda em segundo plano.
+ */
+void BatchRunner::writeDaemonCsv(std::ostream& os) const {
+    os << "trace,algorithm,frames,hand_spread,low_watermark,high_watermark,references,"
+       << "page_faults,hits,hit_rate,fault_ns_mean,fault_ns_p50,fault_ns_p99,fault_ns_max,"
+       << "stalls,daemon_wakeups,daemon_scanned,daemon_cleared,daemon_reclaimed,"
+       << "daemon_busy_s,wall_time_s\n";
+    
+    for (const auto& r : daemonResults) {
+        os << csvField(r.traceFile) << ','
+           << r.algorithm << ','
+           << r.frames << ','
+           << r.handSpread << ','
+           << r.lowWatermark << ','
+           << r.highWatermark << ','
+           << r.stats.totalReferences << ','
+           << r.stats.pageFaults << ','
+           << r.stats.hits << ','
+           << std::fixed << std::setprecision(4) << r.stats.getHitRate() << ','
+           << std::setprecision(1) << r.faultLatency.getMean() << ','
+           << r.faultLatency.getPercentile(0.50) << ','
+           << r.faultLatency.getPercentile(0.99) << ','
+           << r.faultLatency.getMax() << ','
+           << r.stalls << ','
+           << r.daemon.wakeups << ','
+           << r.daemon.framesScanned << ','
+           << r.daemon.bitsCleared << ','
+           << r.daemon.framesReclaimed << ','
+           << std::setprecision(9) << r.daemon.busySeconds << ','
+           << r.wallSeconds << '\n';
+    }
+}
+
+/**
+ * @brief Emite a comparacao Clock x Clock de dois ponteiros em JSON
+ */
+void BatchRunner::writeDaemonJson(std::ostream& os) const {
+    os << "{\n  \"page_daemon\": [\n";
+    
+    for (size_t i = 0; i < daemonResults.size(); ++i) {
+        const auto& r = daemonResults[i];
+        os << "    {"
+           << "\"trace\": \"" << jsonEscape(r.traceFile) << "\", "
+           << "\"algorithm\": \"" << r.algorithm << "\", "
+           << "\"frames\": " << r.frames << ", "
+           << "\"hand_spread\": " << r.handSpread << ", "
+           << "\"low_watermark\": " << r.lowWatermark << ", "
+           << "\"high_watermark\": " << r.highWatermark << ", "
+           << "\"invalid_references\": " << r.invalidReferences << ", "
+           << "\"references\": " << r.stats.totalReferences << ", "
+           << "\"page_faults\": " << r.stats.pageFaults << ", "
+           << "\"hits\": " << r.stats.hits << ", "
+           << "\"hit_rate\": " << std::fixed << std::setprecision(4) << r.stats.getHitRate() << ", "
+           << "\"wall_time_s\": " << std::setprecision(9) << r.wallSeconds << ", "
+           << "\"fault_latency_ns\": {"
+           << "\"mean\": " << std::setprecision(1) << r.faultLatency.getMean() << ", "
+           << "\"p50\": " << r.faultLatency.getPercentile(0.50) << ", "
+           << "\"p99\": " << r.faultLatency.getPercentile(0.99) << ", "
+           << "\"max\": " << r.faultLatency.getMax() << ", "
+           << "\"stalls\": " << r.stalls << "}, "
+           << "\"daemon\": {"
+           << "\"wakeups\": " << r.daemon.wakeups << ", "
+           << "\"scanned\": " << r.daemon.framesScanned << ", "
+           << "\"cleared\": " << r.daemon.bitsCleared << ", "
+           << "\"reclaimed\": " << r.daemon.framesReclaimed << ", "
+           << "\"busy_s\": " << std::setprecision(9) << r.daemon.busySeconds << "}}"
+           << (i + 1 < daemonResults.size() ? "," : "") << "\n";
+    }
+    
+    os << "  ]\n}\n";
+}
@@ -0,0 +1,200 @@
+#include "../include/CARAlgorithm.h"
+#include "../include/Logger.h"
+#include <algorithm>
+
+typedef AdaptiveDirectory Dir;
+
+/**
+ * @brief Construtor do CAR
+ * @param size Numero de frames
+ */
+CARAlgorithm::CARAlgorithm(int size, bool debug)
+    : PageReplacementAlgorithm(size, debug), directory(size), target(0) {
+    
+    if (debugMode) {
+        std::cout << "CARAlgorithm inicializado com " << size << " frames\n";
+    }
+}
+
+/**
+ * @brief Libera um frame girando os relogios
+ *
+ * Com T1 de tamanho ao menos max(1, p) gira o relogio de T1, senao o de
+ * T2. Pagina com bit ligado perde o bit e vai para o fim de T2 (no
+ * relogio de T2 isso e so o avanco do ponteiro); a primeira com bit
+ * desligado vai para B1 ou B2.
+ */
+void CARAlgorithm::replace() {
+    for (;;) {
+        bool fromT1 = directory.size(Dir::T1) >= std::max(1, target);
+        int hand = directory.front(fromT1 ? Dir::T1 : Dir::T2);
+        Dir::Entry& entry = directory[hand];
+        
+        if (!entry.referenced) {
+            lastEvictedPage = entry.page;
+            directory.move(hand, fromT1 ? Dir::B1 : Dir::B2);
+            return;
+        }
+        
+        entry.referenced = 0;
+        directory.move(hand, Dir::T2);
+        Logger::log(LogLevel::TRACE, LogEventType::SECOND_CHANCE, "car",
+                    stats.totalReferences, entry.page, entry.frame);
+    }
+}
+
+/**
+ * @brief Nucleo do CAR, sem mensagens de debug
+ * @param pageNumber Numero da pagina a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+inline bool CARAlgorithm::touchPage(int pageNumber) {
+    stats.totalReferences++;
+    targetHistory.tick(stats.totalReferences, target);
+    lastEvictedPage = -1;
+    
+    int entry = directory.find(pageNumber);
+    if (entry != Dir::NONE && Dir::isResident(directory[entry])) {
+        stats.hits++;
+        directory[entry].referenced = 1;
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_HIT, "car",
+                    stats.totalReferences, pageNumber, directory[entry].frame);
+        return false;
+    }
+    
+    stats.pageFaults++;
+    
+    if (directory.getResidentCount() == memorySize) {
+        replace();
+        
+        // Diretorio cheio: esquece o fantasma mais antigo
+        if (entry == Dir::NONE) {
+            if (directory.size(Dir::T1) + directory.size(Dir::B1) == memorySize) {
+                directory.erase(directory.front(Dir::B1));
+            } else if (directory.getEntryCount() == 2 * memorySize) {
+                directory.erase(directory.front(Dir::B2));
+            }
+        }
+    }
+    
+    if (entry == Dir::NONE) {
+        entry = directory.insert(pageNumber, Dir::T1);
+    } else {
+        // Fantasma: ajusta p para o lado que teria evitado o fault
+        int b1 = directory.size(Dir::B1);
+        int b2 = directory.size(Dir::B2);
+        if (directory[entry].list == Dir::B1) {
+            target = std::min(memorySize, target + std::max(1, b2 / b1));
+        } else {
+            target = std::max(0, target - std::max(1, b1 / b2));
+        }
+        directory.move(entry, Dir::T2);
+        directory[entry].referenced = 0;
+    }
+    
+    int frame = directory[entry].frame;
+    Logger::log(LogLevel::TRACE, LogEventType::PAGE_FAULT, "car",
+                stats.totalReferences, pageNumber, frame);
+    if (lastEvictedPage != -1) {
+        Logger::log(LogLevel::DEBUG, LogEventType::PAGE_EVICTED, "car",
+                    stats.totalReferences, pageNumber, frame, lastEvictedPage);
+    }
+    return true;
+}
+
+/**
+ * @brief Processa um lote de referencias em um laco sem despacho virtual
+ */
+const AlgorithmStatistics& CARAlgorithm::referencePages(const int* pages, size_t n,
+                                                        uint8_t* outHitMask) {
+    return replayBatch(pages, n, outHitMask,
+                       [this](int page) { return touchPage(page); });
+}
+
+/**
+ * @brief Referencia uma pagina
+ * @param pageNumber Numero da pagina a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+bool CARAlgorithm::referencePage(int pageNumber) {
+    if (!debugMode) {
+        return touchPage(pageNumber);
+    }
+    
+    std::cout << "\n--- Referencia a pagina " << pageNumber << " ---\n";
+    
+    int entry = directory.find(pageNumber);
+    int list = entry != Dir::NONE ? directory[entry].list : -1;
+    int previousTarget = target;
+    
+    bool fault = touchPage(pageNumber);
+    if (!fault) {
+        std::cout << "HIT: Pagina " << pageNumber << " em " << (list == Dir::T1 ? "T1" : "T2")
+                  << ", bit de referencia ligado\n";
+    } else {
+        std::cout << "MISS: Pagina " << pageNumber;
+        if (list == Dir::B1 || list == Dir::B2) {
+            std::cout << " lembrada em " << (list == Dir::B1 ? "B1" : "B2")
+                      << " (p: " << previousTarget << " -> " << target << "), entra em T2";
+        } else {
+            std::cout << " nova, entra em T1";
+        }
+        if (lastEvictedPage != -1) {
+            std::cout << "; substitui pagina " << lastEvictedPage;
+        }
+        std::cout << "\n";
+    }
+    
+    displayMemoryState();
+    std::cout << "\n";
+    return fault;
+}
+
+/**
+ * @brief Exibe os dois relogios (a partir do ponteiro) e as fantasmas
+ */
+void CARAlgorithm::displayMemoryState() const {
+    directory.display(true);
+    displayStatistics();
+}
+
+/**
+ * @brief Implementacao do displayMemory para interface
+ */
+void CARAlgorithm::displayMemory() const {
+    displayMemoryState();
+}
+
+/**
+ * @brief Estatisticas e o alvo p atual
+ */
+void CARAlgorithm::displayStatistics() const {
+    PageReplacementAlgorithm::displayStatistics();
+    std::cout << " | p: " << target << "/" << memorySize;
+}
+
+/**
+ * @brief Reseta o algoritmo
+ */
+void CARAlgorithm::reset() {
+    directory.clear();
+    target = 0;
+    targetHistory.clear();
+    lastEvictedPage = -1;
+    stats.reset();
+    
+    if (debugMode) {
+        std::cout << "CARAlgorithm resetado\n";
+    }
+}
+
+/**
+ * @brief Retorna as paginas atualmente na memoria
+ * @return Paginas de T1 e depois de T2, cada relogio a partir do ponteiro
+ */
+std::vector<int> CARAlgorithm::getCurrentPages() const {
+    std::vector<int> pages = directory.getPages(Dir::T1);
+    std::vector<int> frequent = directory.getPages(Dir::T2);
+    pages.insert(pages.end(), frequent.begin(), frequent.end());
+    return pages;
+}
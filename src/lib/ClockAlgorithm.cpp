@@ -1,6 +1,8 @@
 #include "../include/ClockAlgorithm.h"
+#include "../include/Logger.h"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 /**
  * @brief Construtor do ClockAlgorithm
@@ -8,15 +10,15 @@
  * @param debug Habilita modo debug
  */
 ClockAlgorithm::ClockAlgorithm(int size, bool debug) 
-    : PageReplacementAlgorithm(size, debug), frames(size), clockHand(0) {
+    : PageReplacementAlgorithm(size, debug), frames(size > 0 ? size : 0), clockHand(0),
+      loadedFrames(0), useIndex(size > FrameStore::LINEAR_SEARCH_LIMIT) {
     
     if (size <= 0) {
         throw std::invalid_argument("Tamanho da memoria deve ser positivo");
     }
     
-    // Inicializar todos os frames como vazios
-    for (auto& frame : frames) {
-        frame.clear();
+    if (useIndex) {
+        pageTable.reserve(size);
     }
     
     if (debugMode) {
@@ -28,27 +30,46 @@ ClockAlgorithm::ClockAlgorithm(int size, bool debug)
  * @brief Procura uma pagina especifica na memoria
  * @param pageNumber Numero da pagina a procurar
  * @return Indice do frame se encontrado, -1 caso contrario
+ * 
+ * Memorias pequenas e medias sao percorridas com busca SIMD sobre os
+ * numeros de pagina contiguos; acima de LINEAR_SEARCH_LIMIT frames o
+ * indice pagina -> frame responde em O(1).
  */
 int ClockAlgorithm::findPage(int pageNumber) const {
-    for (int i = 0; i < memorySize; ++i) {
-        if (frames[i].valid && frames[i].pageNumber == pageNumber) {
-            return i;
-        }
+    if (!useIndex) {
+        return frames.find(pageNumber);
     }
-    return -1;
+    return pageTable.find(pageNumber);
 }
 
 /**
  * @brief Procura um frame vazio na memoria
  * @return Indice do frame vazio se encontrado, -1 caso contrario
+ * 
+ * Frames so esvaziam no reset (o resize compacta as paginas que
+ * sobram), entao os vazios sao sempre o sufixo
+ * [loadedFrames, memorySize): o menor indice vazio sai de um contador,
+ * sem uma pilha de 4 bytes por frame.
  */
 int ClockAlgorithm::findEmptyFrame() const {
-    for (int i = 0; i < memorySize; ++i) {
-        if (frames[i].isEmpty()) {
-            return i;
+    return loadedFrames < memorySize ? loadedFrames : -1;
+}
+
+/**
+ * @brief Carrega uma pagina em um frame, mantendo o indice sincronizado
+ * @param frameIndex Frame de destino (vazio ou vitima)
+ * @param pageNumber Pagina a carregar
+ */
+void ClockAlgorithm::loadPage(int frameIndex, int pageNumber) {
+    bool occupied = frames.isValid(frameIndex);
+    lastEvictedPage = occupied ? frames.getPage(frameIndex) : -1;
+    if (useIndex) {
+        if (occupied) {
+            pageTable.erase(lastEvictedPage);
         }
+        pageTable.insert(pageNumber, frameIndex);
     }
-    return -1;
+    frames.load(frameIndex, pageNumber);
 }
 
 /**
@@ -66,12 +87,77 @@ void ClockAlgorithm::advanceClock() {
     clockHand = getNextClockPosition();
 }
 
+/**
+ * @brief Nucleo do algoritmo Clock, sem mensagens de debug
+ * @param pageNumber Numero da pagina referenciada
+ * @return true se houve page fault, false se hit
+ */
+inline bool ClockAlgorithm::touchPage(int pageNumber) {
+    stats.totalReferences++;
+    
+    int frameIndex = findPage(pageNumber);
+    if (frameIndex != -1) {
+        frames.setReferenceBit(frameIndex);
+        stats.hits++;
+        lastEvictedPage = -1;
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_HIT, "clock",
+                    stats.totalReferences, pageNumber, frameIndex);
+        return false;
+    }
+    
+    stats.pageFaults++;
+    
+    int emptyFrame = findEmptyFrame();
+    if (emptyFrame != -1) {
+        loadedFrames++;
+        loadPage(emptyFrame, pageNumber);
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_FAULT, "clock",
+                    stats.totalReferences, pageNumber, emptyFrame);
+        return true;
+    }
+    
+    // Com a memoria cheia ha sempre uma vitima em no maximo uma volta.
+    // O ponteiro salta 64 frames por vez; com log de segunda chance
+    // ligado, anda frame a frame para registrar cada uma.
+    if (!Logger::isEnabled(LogLevel::TRACE)) {
+        clockHand = frames.sweepReferenceBits(clockHand);
+    } else {
+        while (frames.getReferenceBit(clockHand)) {
+            frames.clearReferenceBit(clockHand);
+            Logger::log(LogLevel::TRACE, LogEventType::SECOND_CHANCE, "clock",
+                        stats.totalReferences, frames.getPage(clockHand), clockHand);
+            advanceClock();
+        }
+    }
+    
+    loadPage(clockHand, pageNumber);
+    Logger::log(LogLevel::TRACE, LogEventType::PAGE_FAULT, "clock",
+                stats.totalReferences, pageNumber, clockHand);
+    Logger::log(LogLevel::DEBUG, LogEventType::PAGE_EVICTED, "clock",
+                stats.totalReferences, pageNumber, clockHand, lastEvictedPage);
+    advanceClock();
+    return true;
+}
+
+/**
+ * @brief Processa um lote de referencias em um laco sem despacho virtual
+ */
+const AlgorithmStatistics& ClockAlgorithm::referencePages(const int* pages, size_t n,
+                                                          uint8_t* outHitMask) {
+    return replayBatch(pages, n, outHitMask,
+                       [this](int page) { return touchPage(page); });
+}
+
 /**
  * @brief Processa uma referencia de pagina usando o algoritmo Clock
  * @param pageNumber Numero da pagina referenciada
  * @return true se houve page fault, false se hit
  */
 bool ClockAlgorithm::referencePage(int pageNumber) {
+    if (!debugMode) {
+        return touchPage(pageNumber);
+    }
+    
     stats.totalReferences++;
     
     if (debugMode) {
@@ -83,8 +169,9 @@ bool ClockAlgorithm::referencePage(int pageNumber) {
     
     if (frameIndex != -1) {
         // HIT: Pagina encontrada na memoria
-        frames[frameIndex].referenceBit = true;
+        frames.setReferenceBit(frameIndex);
         stats.hits++;
+        lastEvictedPage = -1;
         
         if (debugMode) {
             std::cout << "HIT: Pagina " << pageNumber 
@@ -105,7 +192,8 @@ bool ClockAlgorithm::referencePage(int pageNumber) {
     int emptyFrame = findEmptyFrame();
     if (emptyFrame != -1) {
         // Usar frame vazio
-        frames[emptyFrame] = Frame(pageNumber, true);
+        loadedFrames++;
+        loadPage(emptyFrame, pageNumber);
         
         if (debugMode) {
             std::cout << "Frame vazio " << emptyFrame 
@@ -123,27 +211,27 @@ bool ClockAlgorithm::referencePage(int pageNumber) {
     int iterations = 0;
     
     while (true) {
-        Frame& currentFrame = frames[clockHand];
+        PackedFrame currentFrame = frames.at(clockHand);
         
         if (debugMode) {
             std::cout << "Verificando frame " << clockHand 
-                      << ": pagina " << currentFrame.pageNumber
-                      << ", bit=" << (currentFrame.referenceBit ? 1 : 0);
+                      << ": pagina " << currentFrame.getPage()
+                      << ", bit=" << (currentFrame.getReferenceBit() ? 1 : 0);
         }
         
-        if (!currentFrame.referenceBit) {
+        if (!currentFrame.getReferenceBit()) {
             // Bit de referencia = 0, substituir esta pagina
             if (debugMode) {
-                std::cout << " -> Substituindo pagina " << currentFrame.pageNumber
+                std::cout << " -> Substituindo pagina " << currentFrame.getPage()
                           << " por pagina " << pageNumber << "\n";
             }
             
-            currentFrame = Frame(pageNumber, true);
+            loadPage(clockHand, pageNumber);
             advanceClock();
             break;
         } else {
             // Bit de referencia = 1, dar segunda chance
-            currentFrame.referenceBit = false;
+            frames.clearReferenceBit(clockHand);
             
             if (debugMode) {
                 std::cout << " -> Segunda chance, limpando bit\n";
@@ -170,13 +258,14 @@ void ClockAlgorithm::displayMemory() const {
     std::cout << "Memoria: ";
     
     for (int i = 0; i < memorySize; ++i) {
+        PackedFrame frame = frames.at(i);
         std::cout << "[";
         
-        if (frames[i].isEmpty()) {
+        if (frame.isEmpty()) {
             std::cout << " ";
         } else {
-            std::cout << frames[i].pageNumber;
-            if (frames[i].referenceBit) {
+            std::cout << frame.getPage();
+            if (frame.getReferenceBit()) {
                 std::cout << "*";
             } else {
                 std::cout << " ";
@@ -197,10 +286,11 @@ void ClockAlgorithm::displayMemory() const {
  * @brief Reseta o estado do algoritmo
  */
 void ClockAlgorithm::reset() {
-    for (auto& frame : frames) {
-        frame.clear();
-    }
+    frames.clear();
     clockHand = 0;
+    pageTable.clear();
+    loadedFrames = 0;
+    lastEvictedPage = -1;
     stats.reset();
     
     if (debugMode) {
@@ -208,6 +298,98 @@ void ClockAlgorithm::reset() {
     }
 }
 
+/**
+ * @brief Retorna as paginas atualmente na memoria
+ * @return Vetor com os numeros das paginas, na ordem dos frames
+ */
+std::vector<int> ClockAlgorithm::getCurrentPages() const {
+    std::vector<int> pages;
+    pages.reserve(loadedFrames);
+    for (int i = 0; i < loadedFrames; ++i) {
+        pages.push_back(frames.getPage(i));
+    }
+    return pages;
+}
+
+/**
+ * @brief Muda o numero de frames
+ * @param size Novo numero de frames
+ * 
+ * Ao crescer, os frames novos ficam vazios no sufixo e sao usados antes
+ * de qualquer substituicao. Ao encolher, as paginas que saem sao
+ * escolhidas como num page fault (a partir do ponteiro, bit ligado e
+ * zerado e bit desligado e vitima); as sobreviventes do fim descartado
+ * ocupam os frames liberados. Custa a varredura mais as paginas que
+ * saem, nao o numero de frames. Nao conta faults.
+ */
+void ClockAlgorithm::resize(int size) {
+    if (size <= 0) {
+        throw std::invalid_argument("Tamanho da memoria deve ser positivo");
+    }
+    
+    if (size < loadedFrames) {
+        int toEvict = loadedFrames - size;
+        std::vector<int> holes;
+        holes.reserve(toEvict);
+        
+        while (toEvict > 0) {
+            if (frames.isValid(clockHand)) {
+                if (frames.getReferenceBit(clockHand)) {
+                    frames.clearReferenceBit(clockHand);
+                } else {
+                    if (useIndex) {
+                        pageTable.erase(frames.getPage(clockHand));
+                    }
+                    frames.unload(clockHand);
+                    if (clockHand < size) {
+                        holes.push_back(clockHand);
+                    }
+                    toEvict--;
+                }
+            }
+            clockHand = (clockHand + 1) % loadedFrames;
+        }
+        
+        size_t nextHole = 0;
+        for (int i = size; i < loadedFrames; ++i) {
+            if (!frames.isValid(i)) {
+                continue;
+            }
+            int page = frames.getPage(i);
+            bool referenced = frames.getReferenceBit(i);
+            int hole = holes[nextHole++];
+            frames.load(hole, page);
+            if (!referenced) {
+                frames.clearReferenceBit(hole);
+            }
+            if (useIndex) {
+                pageTable.insert(page, hole);
+            }
+        }
+        
+        loadedFrames = size;
+        if (clockHand >= size) {
+            clockHand = 0;
+        }
+    }
+    
+    frames.resize(size);
+    memorySize = size;
+    lastEvictedPage = -1;
+    
+    bool indexed = size > FrameStore::LINEAR_SEARCH_LIMIT;
+    if (indexed != useIndex) {
+        useIndex = indexed;
+        pageTable.clear();
+        if (useIndex) {
+            pageTable.reserve(size);
+            for (int i = 0; i < loadedFrames; ++i) {
+                pageTable.insert(frames.getPage(i), i);
+            }
+        }
+    }
+}
+
 /**
  * @brief Operador de saida para ClockAlgorithm
  */
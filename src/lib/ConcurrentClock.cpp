@@ -0,0 +1,188 @@
+#include "../include/ConcurrentClock.h"
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief Construtor do Clock concorrente
+ * @param frames Frames do pool compartilhado
+ * @param pages Paginas possiveis (IDs 0..pageCount-1)
+ * @param threadCount Threads que chamarao referencePage
+ */
+ConcurrentClock::ConcurrentClock(int frames, int pages, int threadCount)
+    : memorySize(frames), pageCount(pages), loadedFrames(0), clockHand(0) {
+    
+    if (frames <= 0) {
+        throw std::invalid_argument("Tamanho da memoria deve ser positivo");
+    }
+    if (pages <= 0 || threadCount <= 0) {
+        throw std::invalid_argument("Numero de paginas e de threads deve ser positivo");
+    }
+    
+    pageFrame.reset(new std::atomic<int>[pages]);
+    framePage.reset(new std::atomic<int>[frames]);
+    referenceBits.reset(new std::atomic<uint8_t>[frames]);
+    counters.resize(threadCount);
+    reset();
+}
+
+/**
+ * @brief Volta ao estado inicial (memoria vazia, contadores zerados)
+ */
+void ConcurrentClock::reset() {
+    for (int page = 0; page < pageCount; ++page) {
+        pageFrame[page].store(NOT_RESIDENT, std::memory_order_relaxed);
+    }
+    for (int frame = 0; frame < memorySize; ++frame) {
+        framePage[frame].store(FREE, std::memory_order_relaxed);
+        referenceBits[frame].store(0, std::memory_order_relaxed);
+    }
+    loadedFrames.store(0, std::memory_order_relaxed);
+    clockHand.store(0, std::memory_order_relaxed);
+    for (auto& counter : counters) {
+        counter.stats.reset();
+    }
+}
+
+/**
+ * @brief Reserva um frame para a pagina que a thread esta carregando
+ * @return Frame marcado como BUSY
+ * 
+ * Frames livres sao entregues em ordem por um contador. Com a memoria
+ * cheia, cada fetch_add no ponteiro entrega um frame distinto a thread:
+ * bit ligado e zerado (segunda chance); bit desligado e a pagina e
+ * reservada por CAS, que falha se outra thread ja a escolheu. Frames
+ * BUSY (carga em andamento) sao pulados.
+ */
+int ConcurrentClock::claimFrame() {
+    if (loadedFrames.load(std::memory_order_relaxed) < memorySize) {
+        int frame = loadedFrames.fetch_add(1, std::memory_order_relaxed);
+        if (frame < memorySize) {
+            framePage[frame].store(BUSY, std::memory_order_relaxed);
+            return frame;
+        }
+    }
+    
+    for (int examined = 1; ; ++examined) {
+        int frame = static_cast<int>(clockHand.fetch_add(1, std::memory_order_relaxed) %
+                                     static_cast<uint64_t>(memorySize));
+        
+        if (referenceBits[frame].load(std::memory_order_relaxed)) {
+            referenceBits[frame].store(0, std::memory_order_relaxed);
+            continue;
+        }
+        
+        int victim = framePage[frame].load(std::memory_order_acquire);
+        if (victim >= 0 && framePage[frame].compare_exchange_strong(victim, BUSY,
+                                                                     std::memory_order_acq_rel)) {
+            pageFrame[victim].store(NOT_RESIDENT, std::memory_order_release);
+            return frame;
+        }
+        
+        // Todos os frames em carga por outras threads: cede o core
+        if (examined % (2 * memorySize) == 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Referencia uma pagina a partir de uma thread
+ * @param thread Indice da thread (0..threadCount-1), um por thread
+ * @param pageNumber Pagina (0..pageCount-1)
+ * @return true se houve page fault, false se foi hit
+ */
+bool ConcurrentClock::referencePage(int thread, int pageNumber) {
+    AlgorithmStatistics& stats = counters[thread].stats;
+    std::atomic<int>& slot = pageFrame[pageNumber];
+    stats.totalReferences++;
+    
+    for (;;) {
+        int frame = slot.load(std::memory_order_acquire);
+        if (frame >= 0) {
+            // Hit: sem lock; so escreve se o bit estiver desligado
+            if (!referenceBits[frame].load(std::memory_order_relaxed)) {
+                referenceBits[frame].store(1, std::memory_order_relaxed);
+            }
+            stats.hits++;
+            return false;
+        }
+        
+        if (frame == LOADING) {
+            std::this_thread::yield();    // Outra thread esta carregando a pagina
+        } else if (slot.compare_exchange_weak(frame, LOADING, std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+    
+    stats.pageFaults++;
+    int frame = claimFrame();
+    referenceBits[frame].store(1, std::memory_order_relaxed);
+    framePage[frame].store(pageNumber, std::memory_order_release);
+    slot.store(frame, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Replay concorrente: cada trace e referenciado por uma thread
+ * @param traces Um trace por thread (IDs 0..pageCount-1)
+ * @param counts Tamanho de cada trace
+ * @return Tempo de parede entre a liberacao das threads e o fim da ultima
+ */
+double ConcurrentClock::replay(const std::vector<const int*>& traces,
+                               const std::vector<size_t>& counts) {
+    if (traces.size() != counts.size() || traces.size() > counters.size()) {
+        throw std::invalid_argument("Numero de traces maior que o de threads");
+    }
+    for (size_t t = 0; t < traces.size(); ++t) {
+        for (size_t i = 0; i < counts[t]; ++i) {
+            if (traces[t][i] < 0 || traces[t][i] >= pageCount) {
+                throw std::out_of_range("Pagina fora do intervalo do Clock concorrente");
+            }
+        }
+    }
+    
+    std::atomic<size_t> ready(0);
+    std::atomic<bool> start(false);
+    std::vector<std::thread> threads;
+    
+    for (size_t t = 0; t < traces.size(); ++t) {
+        threads.emplace_back([this, &traces, &counts, &ready, &start, t] {
+            ready.fetch_add(1);
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            
+            const int* pages = traces[t];
+            int thread = static_cast<int>(t);
+            for (size_t i = 0; i < counts[t]; ++i) {
+                referencePage(thread, pages[i]);
+            }
+        });
+    }
+    
+    while (ready.load() < threads.size()) {
+        std::this_thread::yield();
+    }
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+/**
+ * @brief Soma os contadores de todas as threads
+ */
+AlgorithmStatistics ConcurrentClock::getStatistics() const {
+    AlgorithmStatistics total;
+    for (const auto& counter : counters) {
+        total.totalReferences += counter.stats.totalReferences;
+        total.pageFaults += counter.stats.pageFaults;
+        total.hits += counter.stats.hits;
+    }
+    return total;
+}
@@ -12,8 +12,11 @@ void ConfigurationManager::configureMemory() {
     config.physicalMemorySize = SimulatorUI::getIntInput(
         "Digite o numero de frames na memoria fisica (3-20): ", 3, 20);
     
-    config.virtualMemorySize = SimulatorUI::getIntInput(
-        "Digite o numero de paginas na memoria virtual (10-100): ", 10, 100);
+    // 0 = espaco esparso: qualquer ID de pagina nao negativo de 64 bits
+    do {
+        config.virtualMemorySize = SimulatorUI::getIntInput(
+            "Digite o numero de paginas na memoria virtual (10-100, 0 = esparsa): ", 0, 100);
+    } while (config.virtualMemorySize > 0 && config.virtualMemorySize < 10);
     
     std::cout << "\nHabilitar modo debug? (1=Sim, 0=Nao): ";
     int debug = SimulatorUI::getIntInput("", 0, 1);
@@ -30,18 +33,17 @@ void ConfigurationManager::selectAlgorithm() {
     SimulatorUI::clearScreen();
     std::cout << "=== SELECAO DE ALGORITMO ===\n\n";
     std::cout << "1. Clock (Relogio) - Buffer circular com ponteiro\n";
-    std::cout << "2. Segunda Chance - Lista linear com movimento de paginas\n\n";
+    std::cout << "2. Segunda Chance - Lista linear com movimento de paginas\n";
+    std::cout << "3. LRU - Substitui a pagina usada ha mais tempo (exato, O(1))\n";
+    std::cout << "4. Aging - Contadores de uso deslocados a cada intervalo\n";
+    std::cout << "5. ARC - Listas de recencia e frequencia com alvo adaptativo\n";
+    std::cout << "6. CAR - ARC sobre dois relogios (hit so liga o bit)\n\n";
     
-    int choice = SimulatorUI::getIntInput("Escolha o algoritmo (1-2): ", 1, 2);
+    int choice = SimulatorUI::getIntInput("Escolha o algoritmo (1-6): ", 1, 6);
     
-    AlgorithmType newAlgorithm;
-    if (choice == 1) {
-        newAlgorithm = AlgorithmType::CLOCK;
-        std::cout << "\nAlgoritmo Clock selecionado!\n";
-    } else {
-        newAlgorithm = AlgorithmType::SECOND_CHANCE;
-        std::cout << "\nAlgoritmo Segunda Chance selecionado!\n";
-    }
+    const AlgorithmInfo& selected = MemoryManager::getAlgorithms()[choice - 1];
+    AlgorithmType newAlgorithm = selected.type;
+    std::cout << "\nAlgoritmo " << selected.displayName << " selecionado!\n";
     
     if (newAlgorithm != config.currentAlgorithm) {
         config.currentAlgorithm = newAlgorithm;
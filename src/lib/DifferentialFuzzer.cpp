@@ -0,0 +1,338 @@
+#include "../include/DifferentialFuzzer.h"
+#include "../include/ClockAlgorithm.h"
+#include "../include/SecondChanceAlgorithm.h"
+#include "../include/WorkStealingPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+/**
+ * @brief Gerador splitmix64: estado de 8 bytes, sem alocacao por caso
+ */
+static uint64_t nextRandom(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Inteiro uniforme em [0, bound)
+ */
+static int nextBelow(uint64_t& state, int bound) {
+    return static_cast<int>(nextRandom(state) % static_cast<uint64_t>(bound));
+}
+
+/**
+ * @brief Aplica a sequencia aos dois algoritmos em passo sincronizado
+ * @return Referencia em que divergem, ou -1
+ *
+ * Hit/fault e pagina substituida iguais a cada passo mantem os conjuntos
+ * residentes iguais; a comparacao completa no fim confirma o invariante.
+ */
+static long long compareCase(ClockAlgorithm& clock, SecondChanceAlgorithm& secondChance,
+                             const int* pages, size_t count, std::string* reason) {
+    for (size_t i = 0; i < count; ++i) {
+        bool clockFault = clock.referencePage(pages[i]);
+        bool secondChanceFault = secondChance.referencePage(pages[i]);
+        
+        if (clockFault != secondChanceFault) {
+            if (reason) {
+                *reason = std::string("pagina ") + std::to_string(pages[i]) + ": " +
+                          (clockFault ? "fault no Clock, hit na Segunda Chance"
+                                      : "hit no Clock, fault na Segunda Chance");
+            }
+            return static_cast<long long>(i);
+        }
+        
+        if (clockFault && clock.getLastEvictedPage() != secondChance.getLastEvictedPage()) {
+            if (reason) {
+                *reason = std::string("pagina ") + std::to_string(pages[i]) +
+                          ": Clock substituiu " + std::to_string(clock.getLastEvictedPage()) +
+                          ", Segunda Chance substituiu " +
+                          std::to_string(secondChance.getLastEvictedPage());
+            }
+            return static_cast<long long>(i);
+        }
+    }
+    
+    if (count > 0) {
+        std::vector<int> clockPages = clock.getCurrentPages();
+        std::vector<int> secondChancePages = secondChance.getCurrentPages();
+        std::sort(clockPages.begin(), clockPages.end());
+        std::sort(secondChancePages.begin(), secondChancePages.end());
+        if (clockPages != secondChancePages) {
+            if (reason) {
+                *reason = "conjuntos residentes diferentes ao final";
+            }
+            return static_cast<long long>(count - 1);
+        }
+    }
+    
+    return -1;
+}
+
+/**
+ * @brief Construtor do fuzzer
+ */
+DifferentialFuzzer::DifferentialFuzzer(const FuzzOptions& opts) : options(opts) {
+    if (options.frameCounts.empty()) {
+        for (int frames = 1; frames <= DEFAULT_MAX_FRAMES; ++frames) {
+            options.frameCounts.push_back(frames);
+        }
+    }
+    for (int frames : options.frameCounts) {
+        if (frames <= 0) {
+            throw std::invalid_argument("Numero de frames deve ser positivo");
+        }
+    }
+    if (options.maxLength == 0) {
+        throw std::invalid_argument("Comprimento maximo da sequencia deve ser positivo");
+    }
+}
+
+/**
+ * @brief Gera a sequencia de um caso
+ *
+ * Padroes: uniforme sobre poucas paginas a mais que os frames; laco de
+ * frames + 1 paginas (todo acesso e fault e o ponteiro gira); voltas
+ * completas (todas as residentes referenciadas antes de cada fault);
+ * quentes e frias; e um padrao curto aleatorio repetido.
+ */
+void DifferentialFuzzer::generate(uint64_t seed, uint64_t caseIndex, int frames,
+                                  size_t maxLength, std::vector<int>& sequence) {
+    uint64_t state = seed ^ (caseIndex * 0xD1B54A32D192ED03ULL);
+    size_t length = 1 + static_cast<size_t>(nextRandom(state) % maxLength);
+    sequence.clear();
+    
+    switch (nextBelow(state, 5)) {
+        case 0: {
+            int universe = frames + 1 + nextBelow(state, frames + 1);
+            while (sequence.size() < length) {
+                sequence.push_back(nextBelow(state, universe));
+            }
+            break;
+        }
+        case 1: {
+            int loop = frames + 1 + nextBelow(state, 2);
+            for (int page = 0; sequence.size() < length; page = (page + 1) % loop) {
+                sequence.push_back(page);
+                if (nextBelow(state, 8) == 0 && sequence.size() < length) {
+                    sequence.push_back(page);
+                }
+            }
+            break;
+        }
+        case 2: {
+            int base = 0;
+            while (sequence.size() < length) {
+                for (int i = 0; i < frames && sequence.size() < length; ++i) {
+                    if (nextBelow(state, 4) != 0) {
+                        sequence.push_back(base + nextBelow(state, frames));
+                    }
+                }
+                if (sequence.size() < length) {
+                    sequence.push_back(base + frames);
+                }
+                ++base;
+            }
+            break;
+        }
+        case 3: {
+            int hot = std::max(1, frames - 1);
+            while (sequence.size() < length) {
+                if (nextBelow(state, 4) != 0) {
+                    sequence.push_back(nextBelow(state, hot));
+                } else {
+                    sequence.push_back(hot + nextBelow(state, 2 * frames + 2));
+                }
+            }
+            break;
+        }
+        default: {
+            int patternLength = 2 + nextBelow(state, frames + 1);
+            int universe = frames + 2;
+            int pattern[2 * DEFAULT_MAX_FRAMES + 2];
+            if (patternLength > static_cast<int>(sizeof(pattern) / sizeof(pattern[0]))) {
+                patternLength = sizeof(pattern) / sizeof(pattern[0]);
+            }
+            for (int i = 0; i < patternLength; ++i) {
+                pattern[i] = nextBelow(state, universe);
+            }
+            for (size_t i = 0; sequence.size() < length; ++i) {
+                sequence.push_back(pattern[i % patternLength]);
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Aplica uma sequencia a instancias novas dos dois algoritmos
+ */
+long long DifferentialFuzzer::findDivergence(int frames, const int* pages, size_t count,
+                                             std::string* reason) {
+    ClockAlgorithm clock(frames, false);
+    SecondChanceAlgorithm secondChance(frames, false);
+    return compareCase(clock, secondChance, pages, count, reason);
+}
+
+/**
+ * @brief Reduz uma sequencia divergente
+ * @param sequence Sequencia que diverge com 'frames' frames
+ * @param frames Entrada: frames do caso; saida: menor valor que ainda diverge
+ *
+ * Corta o que vem depois da divergencia, remove trechos de tamanho
+ * decrescente (ate referencias isoladas) enquanto a divergencia
+ * persistir, tenta menos frames e renumera as paginas a partir de 0.
+ */
+std::vector<int> DifferentialFuzzer::minimize(const std::vector<int>& sequence, int& frames) {
+    auto diverges = [&frames](const std::vector<int>& candidate) {
+        return !candidate.empty() &&
+               findDivergence(frames, candidate.data(), candidate.size()) >= 0;
+    };
+    
+    std::vector<int> current = sequence;
+    long long step = findDivergence(frames, current.data(), current.size());
+    if (step < 0) {
+        return current;
+    }
+    current.resize(static_cast<size_t>(step) + 1);
+    
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        
+        for (size_t chunk = std::max<size_t>(1, current.size() / 2); chunk >= 1; chunk /= 2) {
+            for (size_t start = 0; start < current.size(); ) {
+                std::vector<int> candidate(current.begin(), current.begin() + start);
+                candidate.insert(candidate.end(),
+                                 current.begin() + std::min(current.size(), start + chunk),
+                                 current.end());
+                if (diverges(candidate)) {
+                    current.swap(candidate);
+                    changed = true;
+                } else {
+                    start += chunk;
+                }
+            }
+        }
+        
+        for (int fewer = 1; fewer < frames; ++fewer) {
+            if (findDivergence(fewer, current.data(), current.size()) >= 0) {
+                frames = fewer;
+                changed = true;
+                break;
+            }
+        }
+    }
+    
+    // Paginas renumeradas pela ordem da primeira referencia
+    std::unordered_map<int, int> labels;
+    std::vector<int> relabeled;
+    relabeled.reserve(current.size());
+    for (int page : current) {
+        auto inserted = labels.insert(std::make_pair(page, static_cast<int>(labels.size())));
+        relabeled.push_back(inserted.first->second);
+    }
+    if (diverges(relabeled)) {
+        current.swap(relabeled);
+    }
+    
+    return current;
+}
+
+/**
+ * @brief Executa a rodada em paralelo
+ *
+ * Os casos sao divididos em tarefas de CASES_PER_TASK casos no
+ * WorkStealingPool; cada tarefa cria um par Clock/Segunda Chance por
+ * numero de frames e o reaproveita com reset(). Ao encontrar uma
+ * divergencia as tarefas de casos posteriores sao puladas; o relatorio
+ * traz a de menor indice, entao o resultado independe do numero de threads.
+ */
+FuzzReport DifferentialFuzzer::run() {
+    FuzzReport report;
+    std::atomic<uint64_t> firstDivergent(std::numeric_limits<uint64_t>::max());
+    std::atomic<uint64_t> casesRun(0);
+    std::atomic<uint64_t> referencesRun(0);
+    std::mutex divergenceMutex;
+    
+    auto start = std::chrono::steady_clock::now();
+    {
+        WorkStealingPool pool(options.threadCount);
+        
+        for (uint64_t first = 0; first < options.cases; first += CASES_PER_TASK) {
+            uint64_t last = std::min(options.cases, first + CASES_PER_TASK);
+            
+            pool.submit([&, first, last] {
+                if (first > firstDivergent.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                
+                std::vector<std::unique_ptr<ClockAlgorithm>> clocks;
+                std::vector<std::unique_ptr<SecondChanceAlgorithm>> secondChances;
+                for (int frames : options.frameCounts) {
+                    clocks.emplace_back(new ClockAlgorithm(frames, false));
+                    secondChances.emplace_back(new SecondChanceAlgorithm(frames, false));
+                }
+                
+                std::vector<int> sequence;
+                sequence.reserve(options.maxLength);
+                uint64_t references = 0;
+                uint64_t index = first;
+                
+                for (; index < last; ++index) {
+                    size_t lane = static_cast<size_t>(index % options.frameCounts.size());
+                    int frames = options.frameCounts[lane];
+                    generate(options.seed, index, frames, options.maxLength, sequence);
+                    references += sequence.size();
+                    
+                    clocks[lane]->reset();
+                    secondChances[lane]->reset();
+                    std::string reason;
+                    if (compareCase(*clocks[lane], *secondChances[lane],
+                                    sequence.data(), sequence.size(), &reason) >= 0) {
+                        std::lock_guard<std::mutex> lock(divergenceMutex);
+                        if (!report.diverged || index < report.divergence.caseIndex) {
+                            report.diverged = true;
+                            report.divergence.caseIndex = index;
+                            report.divergence.frames = frames;
+                            report.divergence.sequence = sequence;
+                            firstDivergent.store(index, std::memory_order_relaxed);
+                        }
+                        ++index;
+                        break;
+                    }
+                }
+                
+                casesRun += index - first;
+                referencesRun += references;
+            });
+        }
+        
+        pool.wait();
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    report.cases = casesRun.load();
+    report.references = referencesRun.load();
+    report.wallSeconds = std::chrono::duration<double>(end - start).count();
+    
+    if (report.diverged) {
+        FuzzDivergence& divergence = report.divergence;
+        int frames = divergence.frames;
+        divergence.minimized = minimize(divergence.sequence, frames);
+        divergence.minimizedFrames = frames;
+        divergence.step = static_cast<size_t>(findDivergence(frames, divergence.minimized.data(),
+                                                             divergence.minimized.size(),
+                                                             &divergence.reason));
+    }
+    
+    return report;
+}
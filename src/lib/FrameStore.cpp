@@ -0,0 +1,196 @@
+#include "../include/FrameStore.h"
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FRAME_STORE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Busca escalar (qualquer arquitetura)
+ */
+static int searchScalar(const int* pages, int count, int page) {
+    for (int i = 0; i < count; ++i) {
+        if (pages[i] == page) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef FRAME_STORE_X86_SIMD
+
+/**
+ * @brief Busca com SSE2: compara 4 paginas por instrucao
+ */
+__attribute__((target("sse2")))
+static int searchSse2(const int* pages, int count, int page) {
+    const __m128i needle = _mm_set1_epi32(page);
+    int i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pages + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    
+    int tail = searchScalar(pages + i, count - i, page);
+    return tail < 0 ? -1 : i + tail;
+}
+
+/**
+ * @brief Busca com AVX2: compara 8 paginas por instrucao
+ * 
+ * Quatro comparacoes (32 paginas) sao combinadas antes do desvio, para
+ * que o laco tenha um unico salto condicional a cada 32 frames.
+ */
+__attribute__((target("avx2")))
+static int searchAvx2(const int* pages, int count, int page) {
+    const __m256i needle = _mm256_set1_epi32(page);
+    int i = 0;
+    
+    for (; i + 32 <= count; i += 32) {
+        const __m256i* block = reinterpret_cast<const __m256i*>(pages + i);
+        __m256i eq0 = _mm256_cmpeq_epi32(_mm256_loadu_si256(block), needle);
+        __m256i eq1 = _mm256_cmpeq_epi32(_mm256_loadu_si256(block + 1), needle);
+        __m256i eq2 = _mm256_cmpeq_epi32(_mm256_loadu_si256(block + 2), needle);
+        __m256i eq3 = _mm256_cmpeq_epi32(_mm256_loadu_si256(block + 3), needle);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(eq0, eq1), _mm256_or_si256(eq2, eq3));
+        
+        if (!_mm256_testz_si256(any, any)) {
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq0)))
+                          | static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq1))) << 8
+                          | static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq2))) << 16
+                          | static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq3))) << 24;
+            return i + __builtin_ctz(mask);
+        }
+    }
+    
+    for (; i + 8 <= count; i += 8) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pages + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    
+    int tail = searchScalar(pages + i, count - i, page);
+    return tail < 0 ? -1 : i + tail;
+}
+
+#endif
+
+const char* FrameStore::searchName = "scalar";
+FrameStore::SearchFunction FrameStore::search = FrameStore::selectSearch();
+
+/**
+ * @brief Escolhe a busca mais larga suportada pela CPU
+ * 
+ * Executada uma unica vez, na inicializacao estatica do programa, antes
+ * que qualquer thread crie frames.
+ */
+FrameStore::SearchFunction FrameStore::selectSearch() {
+#ifdef FRAME_STORE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        searchName = "avx2";
+        return searchAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        searchName = "sse2";
+        return searchSse2;
+    }
+#endif
+    searchName = "scalar";
+    return searchScalar;
+}
+
+/**
+ * @brief Construtor: todos os frames vazios
+ * @param size Numero de frames
+ */
+FrameStore::FrameStore(int size)
+    : pages(size, -1), referenceBits((size + 63) / 64, 0), validBits((size + 63) / 64, 0),
+      frameCount(size) {}
+
+/**
+ * @brief Avanca o ponteiro do relogio uma palavra de 64 frames por vez
+ * @param start Posicao atual do ponteiro
+ * @return Primeiro frame, a partir de start, com bit de referencia 0
+ * 
+ * Equivale a testar e limpar um bit por passo, mas cada palavra e
+ * resolvida com uma mascara e um count-trailing-zeros: os bits ligados
+ * antes da vitima sao limpos de uma vez. Depois de uma volta completa
+ * todos os bits estao limpos, entao ha sempre uma vitima em no maximo
+ * (palavras + 1) iteracoes.
+ */
+int FrameStore::sweepReferenceBits(int start) {
+    const int words = static_cast<int>(referenceBits.size());
+    const int lastWord = words - 1;
+    const uint64_t tailMask = (frameCount & 63) ? (1ULL << (frameCount & 63)) - 1 : ~0ULL;
+    
+    int word = start >> 6;
+    uint64_t fromMask = ~0ULL << (start & 63);
+    
+    while (true) {
+        uint64_t inRange = fromMask & (word == lastWord ? tailMask : ~0ULL);
+        uint64_t victims = ~referenceBits[word] & inRange;
+        
+        if (victims != 0) {
+            int bit = __builtin_ctzll(victims);
+            // Limpa apenas os bits entre o ponteiro e a vitima
+            referenceBits[word] &= ~(inRange & ((1ULL << bit) - 1));
+            return (word << 6) + bit;
+        }
+        
+        referenceBits[word] &= ~inRange;
+        word = word == lastWord ? 0 : word + 1;
+        fromMask = ~0ULL;
+    }
+}
+
+/**
+ * @brief Esvazia todos os frames
+ */
+void FrameStore::clear() {
+    std::fill(pages.begin(), pages.end(), -1);
+    std::fill(referenceBits.begin(), referenceBits.end(), 0);
+    std::fill(validBits.begin(), validBits.end(), 0);
+}
+
+/**
+ * @brief Muda o numero de frames
+ * @param size Novo numero de frames
+ */
+void FrameStore::resize(int size) {
+    pages.resize(size, -1);
+    referenceBits.resize((size + 63) / 64, 0);
+    validBits.resize((size + 63) / 64, 0);
+    frameCount = size;
+    
+    // Bits alem do ultimo frame ficam zerados (find e a varredura os ignoram)
+    if (size & 63) {
+        uint64_t tailMask = (1ULL << (size & 63)) - 1;
+        referenceBits.back() &= tailMask;
+        validBits.back() &= tailMask;
+    }
+}
+
+/**
+ * @brief Copia do frame no formato compactado (para exibicao)
+ */
+PackedFrame FrameStore::at(int index) const {
+    if (!isValid(index)) {
+        return PackedFrame();
+    }
+    return PackedFrame(pages[index], getReferenceBit(index));
+}
+
+/**
+ * @brief Nome da implementacao de busca em uso
+ */
+const char* FrameStore::getSearchName() {
+    return searchName;
+}
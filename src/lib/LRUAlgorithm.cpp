@@ -0,0 +1,192 @@
+#include "../include/LRUAlgorithm.h"
+#include "../include/Logger.h"
+#include <stdexcept>
+
+/**
+ * @brief Construtor do LRU
+ * @param size Numero de frames
+ */
+LRUAlgorithm::LRUAlgorithm(int size, bool debug)
+    : PageReplacementAlgorithm(size, debug), head(NONE), tail(NONE), loadedFrames(0) {
+    
+    if (size <= 0) {
+        throw std::invalid_argument("Tamanho da memoria deve ser positivo");
+    }
+    
+    Frame empty = {-1, NONE, NONE};
+    frames.assign(size, empty);
+    pageTable.reserve(size);
+    
+    if (debugMode) {
+        std::cout << "LRUAlgorithm inicializado com " << size << " frames\n";
+    }
+}
+
+/**
+ * @brief Retira um frame da lista de recencia
+ */
+inline void LRUAlgorithm::unlink(int frame) {
+    Frame& node = frames[frame];
+    if (node.prev != NONE) {
+        frames[node.prev].next = node.next;
+    } else {
+        head = node.next;
+    }
+    if (node.next != NONE) {
+        frames[node.next].prev = node.prev;
+    } else {
+        tail = node.prev;
+    }
+}
+
+/**
+ * @brief Coloca um frame no inicio da lista (mais recente)
+ */
+inline void LRUAlgorithm::pushFront(int frame) {
+    Frame& node = frames[frame];
+    node.prev = NONE;
+    node.next = head;
+    if (head != NONE) {
+        frames[head].prev = frame;
+    } else {
+        tail = frame;
+    }
+    head = frame;
+}
+
+/**
+ * @brief Nucleo do LRU, sem mensagens de debug
+ * @param pageNumber Numero da pagina a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+inline bool LRUAlgorithm::touchPage(int pageNumber) {
+    stats.totalReferences++;
+    
+    int frame = pageTable.find(pageNumber);
+    if (frame != -1) {
+        stats.hits++;
+        if (frame != head) {
+            unlink(frame);
+            pushFront(frame);
+        }
+        lastEvictedPage = -1;
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_HIT, "lru",
+                    stats.totalReferences, pageNumber, frame);
+        return false;
+    }
+    
+    stats.pageFaults++;
+    
+    if (loadedFrames < memorySize) {
+        frame = loadedFrames++;
+        lastEvictedPage = -1;
+    } else {
+        // Memoria cheia: a vitima e o fim da lista
+        frame = tail;
+        lastEvictedPage = frames[frame].page;
+        pageTable.erase(lastEvictedPage);
+        unlink(frame);
+    }
+    
+    frames[frame].page = pageNumber;
+    pushFront(frame);
+    pageTable.insert(pageNumber, frame);
+    
+    Logger::log(LogLevel::TRACE, LogEventType::PAGE_FAULT, "lru",
+                stats.totalReferences, pageNumber, frame);
+    if (lastEvictedPage != -1) {
+        Logger::log(LogLevel::DEBUG, LogEventType::PAGE_EVICTED, "lru",
+                    stats.totalReferences, pageNumber, frame, lastEvictedPage);
+    }
+    return true;
+}
+
+/**
+ * @brief Processa um lote de referencias em um laco sem despacho virtual
+ */
+const AlgorithmStatistics& LRUAlgorithm::referencePages(const int* pages, size_t n,
+                                                        uint8_t* outHitMask) {
+    return replayBatch(pages, n, outHitMask,
+                       [this](int page) { return touchPage(page); });
+}
+
+/**
+ * @brief Referencia uma pagina
+ * @param pageNumber Numero da pagina a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+bool LRUAlgorithm::referencePage(int pageNumber) {
+    if (!debugMode) {
+        return touchPage(pageNumber);
+    }
+    
+    std::cout << "\n--- Referencia a pagina " << pageNumber << " ---\n";
+    
+    bool fault = touchPage(pageNumber);
+    if (!fault) {
+        std::cout << "HIT: Pagina " << pageNumber << " vai para o inicio da lista\n";
+    } else if (lastEvictedPage != -1) {
+        std::cout << "MISS: Substituindo pagina " << lastEvictedPage
+                  << " (usada ha mais tempo) por " << pageNumber << "\n";
+    } else {
+        std::cout << "MISS: Pagina " << pageNumber << " carregada em frame vazio\n";
+    }
+    
+    displayMemoryState();
+    std::cout << "\n";
+    return fault;
+}
+
+/**
+ * @brief Exibe as paginas da mais recente para a menos recente
+ */
+void LRUAlgorithm::displayMemoryState() const {
+    std::cout << "Memoria (recente -> antiga): ";
+    
+    for (int frame = head; frame != NONE; frame = frames[frame].next) {
+        std::cout << "[" << std::setw(2) << frames[frame].page << "] ";
+    }
+    for (int i = loadedFrames; i < memorySize; ++i) {
+        std::cout << "[  ] ";
+    }
+    
+    displayStatistics();
+}
+
+/**
+ * @brief Implementacao do displayMemory para interface
+ */
+void LRUAlgorithm::displayMemory() const {
+    displayMemoryState();
+}
+
+/**
+ * @brief Reseta o algoritmo
+ */
+void LRUAlgorithm::reset() {
+    Frame empty = {-1, NONE, NONE};
+    frames.assign(memorySize, empty);
+    pageTable.clear();
+    head = NONE;
+    tail = NONE;
+    loadedFrames = 0;
+    lastEvictedPage = -1;
+    stats.reset();
+    
+    if (debugMode) {
+        std::cout << "LRUAlgorithm resetado\n";
+    }
+}
+
+/**
+ * @brief Retorna as paginas atualmente na memoria
+ * @return Paginas da mais recente para a menos recente
+ */
+std::vector<int> LRUAlgorithm::getCurrentPages() const {
+    std::vector<int> pages;
+    pages.reserve(loadedFrames);
+    for (int frame = head; frame != NONE; frame = frames[frame].next) {
+        pages.push_back(frames[frame].page);
+    }
+    return pages;
+}
@@ -0,0 +1,273 @@
+#include "../include/Logger.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+#include <memory>
+
+std::atomic<uint8_t> Logger::threshold(static_cast<uint8_t>(LogLevel::OFF));
+
+/**
+ * @brief Posicao da fila: o numero de sequencia indica se o slot esta
+ *        livre para o produtor (== posicao) ou pronto para o consumidor
+ *        (== posicao + 1)
+ */
+struct LogSlot {
+    std::atomic<size_t> sequence;
+    LogEvent event;
+};
+
+/**
+ * @brief Estado do logger ativo (fila, thread e destino)
+ */
+struct LoggerState {
+    std::unique_ptr<LogSlot[]> slots;
+    std::atomic<size_t> enqueuePos;       // Proxima posicao reservada pelos produtores
+    std::atomic<size_t> writtenCount;     // Eventos ja escritos pelo consumidor
+    std::atomic<bool> stopping;
+    size_t dequeuePos;                    // Usado apenas pela thread do logger
+    
+    std::ofstream file;
+    std::ostream* out;
+    std::thread writer;
+    
+    LoggerState() : slots(new LogSlot[Logger::QUEUE_CAPACITY]), enqueuePos(0),
+                    writtenCount(0), stopping(false), dequeuePos(0), out(nullptr) {
+        for (size_t i = 0; i < Logger::QUEUE_CAPACITY; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Dono do estado: usado apenas pela thread que chama start/stop/flush
+static std::unique_ptr<LoggerState> state;
+
+// Visao dos produtores: stop() anula o ponteiro e so libera o estado
+// depois que nenhum produtor estiver mais dentro de push()
+static std::atomic<LoggerState*> activeState(nullptr);
+static std::atomic<size_t> activeProducers(0);
+
+/**
+ * @brief Formata um evento em uma linha de texto
+ */
+static void formatEvent(std::ostream& os, const LogEvent& event) {
+    os << "[" << Logger::getLevelName(event.level) << "] " << event.source
+       << " #" << event.step << " ";
+    
+    switch (event.type) {
+        case LogEventType::PAGE_HIT:
+            os << "hit pagina=" << event.page << " frame=" << event.frame;
+            break;
+        case LogEventType::PAGE_FAULT:
+            os << "fault pagina=" << event.page << " frame=" << event.frame;
+            break;
+        case LogEventType::PAGE_EVICTED:
+            os << "substituicao pagina=" << event.evictedPage << " -> " << event.page
+               << " frame=" << event.frame;
+            break;
+        case LogEventType::SECOND_CHANCE:
+            os << "segunda-chance pagina=" << event.page << " frame=" << event.frame;
+            break;
+        case LogEventType::INVALID_PAGE:
+            os << "pagina invalida=" << event.page;
+            break;
+    }
+    os << "\n";
+}
+
+/**
+ * @brief Laco da thread do logger: retira eventos da fila e os escreve
+ * 
+ * Os eventos sao formatados em lote num buffer local, com uma unica
+ * escrita no destino por lote.
+ */
+static void writerLoop(LoggerState* logger) {
+    const size_t mask = Logger::QUEUE_CAPACITY - 1;
+    std::ostringstream buffer;
+    
+    while (true) {
+        size_t drained = 0;
+        
+        while (drained < Logger::QUEUE_CAPACITY) {
+            LogSlot& slot = logger->slots[logger->dequeuePos & mask];
+            if (slot.sequence.load(std::memory_order_acquire) != logger->dequeuePos + 1) {
+                break;
+            }
+            
+            formatEvent(buffer, slot.event);
+            slot.sequence.store(logger->dequeuePos + Logger::QUEUE_CAPACITY, std::memory_order_release);
+            logger->dequeuePos++;
+            drained++;
+        }
+        
+        if (drained > 0) {
+            *logger->out << buffer.str();
+            logger->out->flush();
+            buffer.str("");
+            logger->writtenCount.fetch_add(drained, std::memory_order_release);
+            continue;
+        }
+        
+        // Fila vazia: so encerra depois de escrever tudo o que foi publicado
+        if (logger->stopping.load(std::memory_order_acquire) &&
+            logger->writtenCount.load(std::memory_order_relaxed) ==
+            logger->enqueuePos.load(std::memory_order_acquire)) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+/**
+ * @brief Inicia o logger
+ * @param level Menor nivel a emitir
+ * @param path Arquivo de destino (vazio = stderr)
+ */
+void Logger::start(LogLevel level, const std::string& path) {
+    if (state) {
+        throw std::runtime_error("Logger ja iniciado");
+    }
+    if (level == LogLevel::OFF) {
+        return;
+    }
+    
+    std::unique_ptr<LoggerState> logger(new LoggerState());
+    if (path.empty()) {
+        logger->out = &std::cerr;
+    } else {
+        logger->file.open(path.c_str());
+        if (!logger->file) {
+            throw std::runtime_error("Nao foi possivel criar o arquivo de log: " + path);
+        }
+        logger->out = &logger->file;
+    }
+    
+    logger->writer = std::thread(writerLoop, logger.get());
+    state = std::move(logger);
+    activeState.store(state.get(), std::memory_order_seq_cst);
+    threshold.store(static_cast<uint8_t>(level), std::memory_order_release);
+}
+
+/**
+ * @brief Desliga o log, escreve os eventos pendentes e encerra a thread
+ * 
+ * Um produtor que ja passou por isEnabled pode ainda estar publicando:
+ * depois de retirar o estado dos produtores, espera que todos saiam de
+ * push(), para que nenhum evento fique sem escrita e nenhum escreva em
+ * memoria liberada.
+ */
+void Logger::stop() {
+    if (!state) {
+        return;
+    }
+    
+    threshold.store(static_cast<uint8_t>(LogLevel::OFF), std::memory_order_release);
+    activeState.store(nullptr, std::memory_order_seq_cst);
+    while (activeProducers.load(std::memory_order_seq_cst) != 0) {
+        std::this_thread::yield();
+    }
+    
+    state->stopping.store(true, std::memory_order_release);
+    state->writer.join();
+    state.reset();
+}
+
+/**
+ * @brief Aguarda a escrita de todos os eventos publicados ate agora
+ */
+void Logger::flush() {
+    if (!state) {
+        return;
+    }
+    
+    size_t target = state->enqueuePos.load(std::memory_order_acquire);
+    while (state->writtenCount.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief Publica um evento na fila (varios produtores, sem lock)
+ * 
+ * Cada produtor reserva uma posicao com compare-and-swap e publica o
+ * evento atualizando o numero de sequencia do slot. Com a fila cheia o
+ * produtor cede a vez ate a thread do logger liberar espaco, de modo que
+ * nenhum evento e descartado.
+ * 
+ * O produtor se registra em activeProducers antes de ler o estado: ou
+ * ve o ponteiro ja anulado por stop(), ou stop() o ve registrado e
+ * espera a publicacao terminar (ambos seq_cst).
+ */
+void Logger::push(const LogEvent& event) {
+    activeProducers.fetch_add(1, std::memory_order_seq_cst);
+    LoggerState* logger = activeState.load(std::memory_order_seq_cst);
+    if (!logger) {
+        activeProducers.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+    
+    const size_t mask = QUEUE_CAPACITY - 1;
+    size_t pos = logger->enqueuePos.load(std::memory_order_relaxed);
+    LogSlot* slot;
+    
+    while (true) {
+        slot = &logger->slots[pos & mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        
+        if (sequence == pos) {
+            if (logger->enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < pos) {
+            // Slot ainda nao consumido: fila cheia
+            std::this_thread::yield();
+            pos = logger->enqueuePos.load(std::memory_order_relaxed);
+        } else {
+            pos = logger->enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    
+    slot->event = event;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    activeProducers.fetch_sub(1, std::memory_order_release);
+}
+
+/**
+ * @brief Converte nome em nivel de log
+ * @return false se o nome nao for reconhecido
+ */
+bool Logger::parseLevel(const std::string& name, LogLevel& level) {
+    if (name == "trace") {
+        level = LogLevel::TRACE;
+    } else if (name == "debug") {
+        level = LogLevel::DEBUG;
+    } else if (name == "info") {
+        level = LogLevel::INFO;
+    } else if (name == "warn") {
+        level = LogLevel::WARN;
+    } else if (name == "error") {
+        level = LogLevel::ERROR;
+    } else if (name == "off") {
+        level = LogLevel::OFF;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Nome do nivel de log
+ */
+std::string Logger::getLevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::TRACE: return "TRACE";
+        case LogLevel::DEBUG: return "DEBUG";
+        case LogLevel::INFO: return "INFO";
+        case LogLevel::WARN: return "WARN";
+        case LogLevel::ERROR: return "ERROR";
+        case LogLevel::OFF: return "OFF";
+        default: return "UNKNOWN";
+    }
+}
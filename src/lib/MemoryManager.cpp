@@ -1,29 +1,64 @@
 #include "../include/MemoryManager.h"
+#include "../include/Logger.h"
+#include "../include/ReplayEngine.h"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
 #include <sstream>
+#include <unordered_map>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @brief Algoritmos do menu, na ordem de AlgorithmType
+ */
+const std::vector<AlgorithmInfo>& MemoryManager::getAlgorithms() {
+    static const std::vector<AlgorithmInfo> ALGORITHMS = {
+        {AlgorithmType::CLOCK, ReplayPolicy::CLOCK, "Clock (Relogio)"},
+        {AlgorithmType::SECOND_CHANCE, ReplayPolicy::SECOND_CHANCE, "Segunda Chance"},
+        {AlgorithmType::LRU, ReplayPolicy::LRU, "LRU (Menos Recentemente Usada)"},
+        {AlgorithmType::AGING, ReplayPolicy::AGING, "Aging (NFU com Envelhecimento)"},
+        {AlgorithmType::ARC, ReplayPolicy::ARC, "ARC (Adaptive Replacement Cache)"},
+        {AlgorithmType::CAR, ReplayPolicy::CAR, "CAR (Clock com Substituicao Adaptativa)"}
+    };
+    return ALGORITHMS;
+}
+
+/**
+ * @brief Entrada da tabela de algoritmos para o tipo informado
+ */
+const AlgorithmInfo& MemoryManager::getAlgorithmInfo(AlgorithmType type) {
+    return getAlgorithms()[static_cast<size_t>(type)];
+}
 
 /**
  * @brief Construtor do MemoryManager
  */
-MemoryManager::MemoryManager(int physicalMemorySize, int virtualMemorySize, 
+MemoryManager::MemoryManager(int physicalMemorySize, int64_t virtualMemorySize, 
                            bool debug, bool logging, AlgorithmType algorithm)
-    : virtualMemorySize(virtualMemorySize), loggingEnabled(logging), 
-      currentAlgorithm(algorithm) {
+    : activeAlgorithm(nullptr), referenceStep(0), virtualMemorySize(0), sparse(true),
+      loggingEnabled(logging), currentAlgorithm(algorithm) {
     
-    if (physicalMemorySize <= 0 || virtualMemorySize <= 0) {
+    if (physicalMemorySize <= 0 || virtualMemorySize < 0) {
         throw std::invalid_argument("Tamanhos de memoria devem ser positivos");
     }
     
-    // Inicializa ambos os algoritmos
-    clockAlgorithm.reset(new ClockAlgorithm(physicalMemorySize, debug));
-    secondChanceAlgorithm.reset(new SecondChanceAlgorithm(physicalMemorySize, debug));
+    // Uma instancia de cada algoritmo da tabela
+    for (const AlgorithmInfo& info : getAlgorithms()) {
+        algorithms.push_back(PolicyFactory::createAlgorithm(info.policy, physicalMemorySize, debug));
+    }
+    updateActiveAlgorithm();
+    setVirtualMemorySize(virtualMemorySize);
     
     if (loggingEnabled) {
         std::cout << "MemoryManager inicializado:\n";
         std::cout << "- Memoria Fisica: " << physicalMemorySize << " frames\n";
-        std::cout << "- Memoria Virtual: " << virtualMemorySize << " paginas\n";
+        if (virtualMemorySize == 0) {
+            std::cout << "- Memoria Virtual: esparsa (IDs de 64 bits)\n";
+        } else {
+            std::cout << "- Memoria Virtual: " << virtualMemorySize << " paginas\n";
+        }
         std::cout << "- Algoritmo: " << getCurrentAlgorithmName() << "\n";
     }
 }
@@ -31,8 +66,46 @@ MemoryManager::MemoryManager(int physicalMemorySize, int virtualMemorySize,
 /**
  * @brief Valida se o numero da pagina e valido
  */
-bool MemoryManager::isValidPageNumber(int pageNumber) const {
-    return pageNumber >= 0 && pageNumber < virtualMemorySize;
+bool MemoryManager::isValidPageNumber(int64_t pageNumber) const {
+    return pageNumber >= 0 && (virtualMemorySize == 0 || pageNumber < virtualMemorySize);
+}
+
+/**
+ * @brief ID original de uma pagina interna (ex.: pagina substituida)
+ */
+int64_t MemoryManager::toPageId(int internalPage) const {
+    if (!sparse || internalPage < 0) {
+        return internalPage;
+    }
+    return pageMap.getPageId(internalPage);
+}
+
+/**
+ * @brief Traduz um bloco de paginas para os IDs dos algoritmos
+ * 
+ * Paginas invalidas viram -1. No modo denso as paginas ja sao os IDs
+ * internos e o bloco e usado sem copia.
+ */
+const int* MemoryManager::toInternalPages(const int* pages, size_t n, std::vector<int>& buffer) {
+    if (!sparse) {
+        return pages;
+    }
+    buffer.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        buffer[i] = pages[i] >= 0 ? pageMap.intern(pages[i]) : -1;
+    }
+    return buffer.data();
+}
+
+/**
+ * @brief Traduz um bloco de paginas de 64 bits para os IDs dos algoritmos
+ */
+const int* MemoryManager::toInternalPages(const int64_t* pages, size_t n, std::vector<int>& buffer) {
+    buffer.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        buffer[i] = isValidPageNumber(pages[i]) ? toInternalPage(pages[i]) : -1;
+    }
+    return buffer.data();
 }
 
 /**
@@ -50,36 +123,28 @@ std::string MemoryManager::getResultString(ReferenceResult result) const {
 /**
  * @brief Processa uma referencia de pagina
  */
-ReferenceResult MemoryManager::processPageReference(int pageNumber) {
+ReferenceResult MemoryManager::processPageReference(int64_t pageNumber) {
     // Validar numero da pagina
     if (!isValidPageNumber(pageNumber)) {
         if (loggingEnabled) {
-            std::cout << "ERRO: Pagina " << pageNumber << " e invalida "
-                      << "(deve estar entre 0 e " << virtualMemorySize-1 << ")\n";
+            std::cout << "ERRO: Pagina " << pageNumber << " e invalida ";
+            if (virtualMemorySize > 0) {
+                std::cout << "(deve estar entre 0 e " << virtualMemorySize-1 << ")\n";
+            } else {
+                std::cout << "(deve ser nao negativa)\n";
+            }
         }
         
-        referenceHistory.emplace_back(pageNumber, ReferenceResult::INVALID, 
-                                    "Numero de pagina invalido");
+        recordReference(pageNumber, ReferenceResult::INVALID);
         return ReferenceResult::INVALID;
     }
     
     // Processar referencia com algoritmo ativo
-    bool pageFault;
-    if (currentAlgorithm == AlgorithmType::CLOCK) {
-        pageFault = clockAlgorithm->referencePage(pageNumber);
-    } else {
-        pageFault = secondChanceAlgorithm->referencePage(pageNumber);
-    }
+    bool pageFault = activeAlgorithm->referencePage(toInternalPage(pageNumber));
     ReferenceResult result = pageFault ? ReferenceResult::MISS : ReferenceResult::HIT;
     
     // Registrar no historico
-    std::stringstream desc;
-    desc << "Pagina " << pageNumber << " - " << getResultString(result);
-    if (pageFault) {
-        desc << " (Page Fault)";
-    }
-    
-    referenceHistory.emplace_back(pageNumber, result, desc.str());
+    recordReference(pageNumber, result, toPageId(activeAlgorithm->getLastEvictedPage()));
     
     // Log da operacao
     if (loggingEnabled) {
@@ -96,30 +161,151 @@ ReferenceResult MemoryManager::processPageReference(int pageNumber) {
     return result;
 }
 
+/**
+ * @brief Registra uma referencia no historico (registro compacto)
+ * 
+ * O passo avanca mesmo com o historico desabilitado, para que a
+ * numeracao continue correta se ele for reabilitado.
+ */
+void MemoryManager::recordReference(int64_t pageNumber, ReferenceResult result, int64_t evictedPage) {
+    ++referenceStep;
+    if (result == ReferenceResult::INVALID) {
+        Logger::log(LogLevel::WARN, LogEventType::INVALID_PAGE, "memory", referenceStep, pageNumber);
+    }
+    if (referenceHistory.isEnabled()) {
+        referenceHistory.record(ReferenceRecord(referenceStep, pageNumber, result, evictedPage));
+    }
+}
+
+/**
+ * @brief Processa referencias em lote pelo algoritmo ativo (sem log)
+ * 
+ * Trechos de paginas validas sao entregues a referencePages de uma vez;
+ * paginas invalidas interrompem o trecho. So as ultimas referencias do
+ * lote, que ainda cabem no buffer do historico, sao processadas uma a uma
+ * para registrar o resultado e a pagina substituida; com o historico
+ * desabilitado nenhum registro e montado. No modo esparso cada bloco
+ * e traduzido para IDs internos antes de chegar ao algoritmo.
+ */
+template <typename Page>
+void MemoryManager::processBatch(const Page* pages, size_t n) {
+    const size_t kBatchSize = 4096;
+    size_t capacity = referenceHistory.getCapacity();
+    size_t tracked = n > capacity ? n - capacity : 0;  // Inicio do trecho registrado
+    std::vector<int> buffer;
+    size_t i = 0;
+    
+    while (i < tracked) {
+        size_t chunk = std::min(kBatchSize, tracked - i);
+        const int* internal = toInternalPages(pages + i, chunk, buffer);
+        size_t j = 0;
+        
+        while (j < chunk) {
+            if (!isValidPageNumber(internal[j])) {
+                Logger::log(LogLevel::WARN, LogEventType::INVALID_PAGE, "memory",
+                            referenceStep + i + j + 1, pages[i + j]);
+                ++j;
+                continue;
+            }
+            
+            size_t end = j;
+            while (end < chunk && isValidPageNumber(internal[end])) {
+                ++end;
+            }
+            
+            activeAlgorithm->referencePages(internal + j, end - j);
+            j = end;
+        }
+        i += chunk;
+    }
+    referenceStep += tracked;
+    
+    for (; i < n; ++i) {
+        if (!isValidPageNumber(pages[i])) {
+            recordReference(pages[i], ReferenceResult::INVALID);
+            continue;
+        }
+        
+        bool pageFault = activeAlgorithm->referencePage(toInternalPage(pages[i]));
+        recordReference(pages[i], pageFault ? ReferenceResult::MISS : ReferenceResult::HIT,
+                        toPageId(activeAlgorithm->getLastEvictedPage()));
+    }
+}
+
 /**
  * @brief Processa uma sequencia de referencias
  */
 void MemoryManager::processSequence(const std::vector<int>& pageSequence) {
+    processPages(pageSequence.data(), pageSequence.size());
+}
+
+/**
+ * @brief Processa uma sequencia de IDs de 64 bits (espaco esparso)
+ */
+void MemoryManager::processSequence(const std::vector<int64_t>& pageSequence) {
+    processPages(pageSequence.data(), pageSequence.size());
+}
+
+/**
+ * @brief Processa uma sequencia a partir de uma visao (ex.: trace mapeado)
+ */
+void MemoryManager::processSequence(const int* pages, size_t length) {
+    processPages(pages, length);
+}
+
+/**
+ * @brief Processa uma sequencia (com log passo a passo ou em lote)
+ */
+template <typename Page>
+void MemoryManager::processPages(const Page* pages, size_t length) {
     if (loggingEnabled) {
         std::cout << "\n=== PROCESSANDO SEQUENCIA DE PAGINAS ===\n";
         std::cout << "Sequencia: ";
-        for (size_t i = 0; i < pageSequence.size(); ++i) {
-            std::cout << pageSequence[i];
-            if (i < pageSequence.size() - 1) std::cout << " ";
+        for (size_t i = 0; i < length; ++i) {
+            std::cout << pages[i];
+            if (i < length - 1) std::cout << " ";
         }
         std::cout << "\n\n";
     }
     
-    for (size_t i = 0; i < pageSequence.size(); ++i) {
+    if (!loggingEnabled) {
+        processBatch(pages, length);
+        return;
+    }
+    
+    for (size_t i = 0; i < length; ++i) {
+        std::cout << "Step " << (i + 1) << ": ";
+        processPageReference(pages[i]);
+    }
+    
+    if (loggingEnabled) {
+        std::cout << "\n=== SEQUENCIA PROCESSADA ===\n";
+        displayDetailedStatistics();
+    }
+}
+
+/**
+ * @brief Processa um trace em streaming, bloco a bloco
+ * 
+ * Cada bloco entregue pelo TraceStream e processado enquanto a thread de
+ * leitura ja carrega o proximo; o trace nunca fica inteiro na memoria.
+ */
+void MemoryManager::processStream(TraceStream& stream) {
+    const int* pages;
+    size_t count;
+    
+    while (stream.nextChunk(pages, count)) {
         if (loggingEnabled) {
-            std::cout << "Step " << (i + 1) << ": ";
+            for (size_t i = 0; i < count; ++i) {
+                processPageReference(pages[i]);
+            }
+        } else {
+            processBatch(pages, count);
         }
-        
-        processPageReference(pageSequence[i]);
     }
     
     if (loggingEnabled) {
-        std::cout << "\n=== SEQUENCIA PROCESSADA ===\n";
+        std::cout << "\n=== TRACE PROCESSADO ===\n";
         displayDetailedStatistics();
     }
 }
@@ -127,19 +313,37 @@ void MemoryManager::processSequence(const std::vector<int>& pageSequence) {
 /**
  * @brief Define o tamanho da memoria virtual
  */
-void MemoryManager::setVirtualMemorySize(int size) {
-    if (size <= 0) {
+void MemoryManager::setVirtualMemorySize(int64_t size) {
+    if (size < 0) {
         throw std::invalid_argument("Tamanho da memoria virtual deve ser positivo");
     }
+    
+    // Acima de MAX_PAGE + 1 paginas os IDs nao cabem nos frames e passam pelo pageMap
+    bool wasSparse = sparse;
     virtualMemorySize = size;
+    sparse = size == 0 || size > static_cast<int64_t>(PackedFrame::MAX_PAGE) + 1;
+    if (sparse != wasSparse) {
+        for (auto& algorithm : algorithms) {
+            algorithm->reset();
+        }
+        pageMap.clear();
+    }
 }
 
 /**
  * @brief Habilita/desabilita modo debug
  */
 void MemoryManager::enableDebug(bool enable) {
-    clockAlgorithm->setDebugMode(enable);
-    secondChanceAlgorithm->setDebugMode(enable);
+    for (auto& algorithm : algorithms) {
+        algorithm->setDebugMode(enable);
+    }
+}
+
+/**
+ * @brief Define quantas referencias o historico guarda (0 desabilita)
+ */
+void MemoryManager::setHistoryCapacity(size_t capacity) {
+    referenceHistory.setCapacity(capacity);
 }
 
 /**
@@ -147,57 +351,54 @@ void MemoryManager::enableDebug(bool enable) {
  */
 void MemoryManager::setAlgorithm(AlgorithmType algorithm) {
     currentAlgorithm = algorithm;
+    updateActiveAlgorithm();
     
     if (loggingEnabled) {
         std::cout << "Algoritmo alterado para: " << getCurrentAlgorithmName() << "\n";
     }
 }
 
+/**
+ * @brief Aponta activeAlgorithm para a instancia do algoritmo atual
+ */
+void MemoryManager::updateActiveAlgorithm() {
+    activeAlgorithm = algorithms[static_cast<size_t>(currentAlgorithm)].get();
+}
+
 /**
  * @brief Retorna o nome do algoritmo atual
  */
 std::string MemoryManager::getCurrentAlgorithmName() const {
-    switch (currentAlgorithm) {
-        case AlgorithmType::CLOCK:
-            return "Clock (Relogio)";
-        case AlgorithmType::SECOND_CHANCE:
-            return "Segunda Chance";
-        default:
-            return "Desconhecido";
-    }
+    return getAlgorithmInfo(currentAlgorithm).displayName;
 }
 
 /**
  * @brief Obtem estatisticas do algoritmo ativo
  */
 const AlgorithmStatistics& MemoryManager::getStatistics() const {
-    if (currentAlgorithm == AlgorithmType::CLOCK) {
-        return clockAlgorithm->getStatistics();
-    } else {
-        return secondChanceAlgorithm->getStatistics();
-    }
+    return activeAlgorithm->getStatistics();
 }
 
 /**
  * @brief Obtem tamanho da memoria fisica
  */
 int MemoryManager::getPhysicalMemorySize() const {
-    if (currentAlgorithm == AlgorithmType::CLOCK) {
-        return clockAlgorithm->getMemorySize();
-    } else {
-        // SecondChance não tem getMemorySize, vamos usar os dados do Clock
-        return clockAlgorithm->getMemorySize();
-    }
+    return activeAlgorithm->getMemorySize();
 }
 
 /**
  * @brief Exibe estado atual da memoria
  */
 void MemoryManager::displayCurrentState() const {
-    if (currentAlgorithm == AlgorithmType::CLOCK) {
-        clockAlgorithm->displayMemory();
-    } else {
-        secondChanceAlgorithm->displayMemory();
+    activeAlgorithm->displayMemory();
+    
+    // No modo esparso os frames mostram IDs internos; exibe a traducao
+    const size_t MAX_LEGEND = 32;
+    if (sparse && pageMap.size() > 0 && pageMap.size() <= MAX_LEGEND) {
+        std::cout << "\nPaginas (ID interno = ID original):";
+        for (size_t i = 0; i < pageMap.size(); ++i) {
+            std::cout << " " << i << "=" << pageMap.getPageId(static_cast<int>(i));
+        }
     }
 }
 
@@ -215,24 +416,30 @@ void MemoryManager::displayDetailedStatistics() const {
     std::cout << "Taxa de Page Fault: " << stats.getFaultRate() << "%\n";
     std::cout << "Taxa de Hit: " << stats.getHitRate() << "%\n";
     std::cout << "Memoria Fisica: " << getPhysicalMemorySize() << " frames\n";
-    std::cout << "Memoria Virtual: " << virtualMemorySize << " paginas\n";
+    if (virtualMemorySize == 0) {
+        std::cout << "Memoria Virtual: esparsa (" << pageMap.size() << " paginas tocadas)\n";
+    } else {
+        std::cout << "Memoria Virtual: " << virtualMemorySize << " paginas\n";
+    }
 }
 
 /**
  * @brief Exibe historico de referencias
+ * 
+ * As descricoes sao montadas aqui, apenas para os registros exibidos.
  */
 void MemoryManager::displayHistory(int lastN) const {
     std::cout << "=== HISTORICO DE REFERENCIAS ===\n";
     
-    int start = 0;
-    if (lastN > 0 && lastN < static_cast<int>(referenceHistory.size())) {
+    size_t start = 0;
+    if (lastN > 0 && static_cast<size_t>(lastN) < referenceHistory.size()) {
         start = referenceHistory.size() - lastN;
     }
     
     for (size_t i = start; i < referenceHistory.size(); ++i) {
-        const auto& ref = referenceHistory[i];
-        std::cout << std::setw(3) << (i + 1) << ": " 
-                  << ref.description << "\n";
+        const ReferenceRecord& ref = referenceHistory[i];
+        std::cout << std::setw(3) << ref.getStep() << ": " 
+                  << ref.describe() << "\n";
     }
 }
 
@@ -241,7 +448,7 @@ void MemoryManager::displayHistory(int lastN) const {
  */
 void MemoryManager::compareWithFIFO(const std::vector<int>& sequence) const {
     FIFOSimulator fifo(getPhysicalMemorySize());
-    int fifoFaults = fifo.simulate(sequence);
+    uint64_t fifoFaults = fifo.simulate(sequence);
     
     const auto& clockStats = getStatistics();
     
@@ -263,7 +470,7 @@ void MemoryManager::compareWithFIFO(const std::vector<int>& sequence) const {
  */
 void MemoryManager::compareWithOptimal(const std::vector<int>& sequence) const {
     OptimalSimulator optimal(getPhysicalMemorySize());
-    int optimalFaults = optimal.simulate(sequence);
+    uint64_t optimalFaults = optimal.simulate(sequence);
     
     const auto& clockStats = getStatistics();
     
@@ -284,9 +491,12 @@ void MemoryManager::compareWithOptimal(const std::vector<int>& sequence) const {
  * @brief Reseta o gerenciador de memoria
  */
 void MemoryManager::reset() {
-    clockAlgorithm->reset();
-    secondChanceAlgorithm->reset();
+    for (auto& algorithm : algorithms) {
+        algorithm->reset();
+    }
+    pageMap.clear();
     referenceHistory.clear();
+    referenceStep = 0;
     
     if (loggingEnabled) {
         std::cout << "MemoryManager resetado\n";
@@ -310,23 +520,53 @@ std::ostream& operator<<(std::ostream& os, const MemoryManager& manager) {
  */
 FIFOSimulator::FIFOSimulator(int size) : nextFrame(0), memorySize(size) {
     frames.resize(size, -1);
+    resident.reserve(size);
 }
 
 /**
  * @brief Simula algoritmo FIFO
  */
-int FIFOSimulator::simulate(const std::vector<int>& sequence) {
-    int pageFaults = 0;
+uint64_t FIFOSimulator::simulate(const std::vector<int>& sequence) {
+    return simulate(sequence.data(), sequence.size());
+}
+
+/**
+ * @brief Simula algoritmo FIFO sobre uma visao da sequencia (sem copia)
+ */
+uint64_t FIFOSimulator::simulate(const int* sequence, size_t length) {
+    reset();
+    return process(sequence, length);
+}
+
+/**
+ * @brief Esvazia a memoria simulada
+ */
+void FIFOSimulator::reset() {
     frames.assign(memorySize, -1);
+    resident.clear();
     nextFrame = 0;
+}
+
+/**
+ * @brief Processa um bloco mantendo o estado dos blocos anteriores
+ * @return Page faults ocorridos neste bloco
+ */
+uint64_t FIFOSimulator::process(const int* sequence, size_t length) {
+    uint64_t pageFaults = 0;
     
-    for (int page : sequence) {
+    for (size_t i = 0; i < length; ++i) {
+        int page = sequence[i];
+        
         // Verificar se página já está na memória
-        bool found = std::find(frames.begin(), frames.end(), page) != frames.end();
+        bool found = resident.count(page) != 0;
         
         if (!found) {
-            // Page fault - inserir página
+            // Page fault - substituir a página mais antiga
+            if (frames[nextFrame] != -1) {
+                resident.erase(frames[nextFrame]);
+            }
             frames[nextFrame] = page;
+            resident.insert(page);
             nextFrame = (nextFrame + 1) % memorySize;
             pageFaults++;
         }
@@ -336,61 +576,92 @@ int FIFOSimulator::simulate(const std::vector<int>& sequence) {
 }
 
 /**
- * @brief Encontra vitima otima para substituicao
+ * @brief Calcula o indice do proximo uso de cada referencia
+ * @return nextUse[i] = proxima posicao de sequence[i], ou sequence.size()
+ *         se a pagina nao for mais referenciada
  */
-int OptimalSimulator::findOptimalVictim(const std::vector<int>& frames, 
-                                       const std::vector<int>& sequence, 
-                                       int currentIndex) const {
-    int farthest = currentIndex;
-    int victimIndex = 0;
+std::vector<int> OptimalSimulator::computeNextUse(const int* sequence, size_t length) const {
+    int n = static_cast<int>(length);
+    std::vector<int> nextUse(n);
+    std::unordered_map<int, int> lastSeen;
+    lastSeen.reserve(n);
+    
+    for (int i = n - 1; i >= 0; --i) {
+        auto it = lastSeen.find(sequence[i]);
+        nextUse[i] = it != lastSeen.end() ? it->second : n;
+        lastSeen[sequence[i]] = i;
+    }
     
-    for (size_t i = 0; i < frames.size(); ++i) {
-        int nextUse = sequence.size(); // Assume que nunca será usada novamente
-        
-        // Procurar proximo uso desta pagina
-        for (size_t j = currentIndex + 1; j < sequence.size(); ++j) {
-            if (sequence[j] == frames[i]) {
-                nextUse = j;
-                break;
-            }
-        }
-        
-        if (nextUse > farthest) {
-            farthest = nextUse;
-            victimIndex = i;
-        }
+    return nextUse;
+}
+
+/**
+ * @brief Simula algoritmo otimo (Belady) em O(n log k)
+ * 
+ * Cada pagina residente aparece em 'resident' como (proximo uso, pagina).
+ * Na referencia i, a pagina esta na memoria se e somente se o par (i, pagina)
+ * existe, pois seu proximo uso registrado e exatamente i. A vitima e o
+ * maior elemento do conjunto.
+ */
+uint64_t OptimalSimulator::simulate(const std::vector<int>& sequence) {
+    return simulate(sequence.data(), sequence.size());
+}
+
+/**
+ * @brief Simula algoritmo otimo sobre uma visao da sequencia (sem copia)
+ */
+uint64_t OptimalSimulator::simulate(const int* sequence, size_t length) {
+    prepare(sequence, length);
+    return process(sequence, length);
+}
+
+/**
+ * @brief Calcula o proximo uso de todo o trace e esvazia a memoria
+ */
+void OptimalSimulator::prepare(const int* sequence, size_t length) {
+    // Os indices de proximo uso sao int (4 bytes por referencia)
+    if (length > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        throw std::invalid_argument("Algoritmo otimo suporta no maximo 2^31 - 1 referencias");
     }
     
-    return victimIndex;
+    nextUse = computeNextUse(sequence, length);
+    resident.clear();
+    position = 0;
 }
 
 /**
- * @brief Simula algoritmo otimo (Belady)
+ * @brief Processa o proximo bloco do trace passado a prepare
+ * @return Page faults ocorridos neste bloco
  */
-int OptimalSimulator::simulate(const std::vector<int>& sequence) {
-    int pageFaults = 0;
-    std::vector<int> frames;
+uint64_t OptimalSimulator::process(const int* sequence, size_t length) {
+    if (length > nextUse.size() - position) {
+        throw std::logic_error("OptimalSimulator: bloco alem do trace preparado");
+    }
     
-    for (size_t i = 0; i < sequence.size(); ++i) {
-        int page = sequence[i];
+    uint64_t pageFaults = 0;
+    int end = position + static_cast<int>(length);
+    
+    for (int i = position; i < end; ++i) {
+        int page = sequence[i - position];
         
         // Verificar se pagina ja esta na memoria
-        bool found = std::find(frames.begin(), frames.end(), page) != frames.end();
+        auto it = resident.find(std::make_pair(i, page));
         
-        if (!found) {
+        if (it != resident.end()) {
+            resident.erase(it);
+        } else {
             pageFaults++;
             
-            if (static_cast<int>(frames.size()) < memorySize) {
-                // Ainda ha espaco livre
-                frames.push_back(page);
-            } else {
-                // Precisa substituir - usar algoritmo otimo
-                int victimIndex = findOptimalVictim(frames, sequence, i);
-                frames[victimIndex] = page;
+            if (static_cast<int>(resident.size()) >= memorySize) {
+                // Precisa substituir - vitima com uso mais distante
+                resident.erase(std::prev(resident.end()));
             }
         }
+        
+        resident.insert(std::make_pair(nextUse[i], page));
     }
     
+    position = end;
     return pageFaults;
 }
 
@@ -400,19 +671,14 @@ int OptimalSimulator::simulate(const std::vector<int>& sequence) {
 void MemoryManager::compareClockWithSecondChance(const std::vector<int>& sequence) const {
     std::cout << "\n=== COMPARACAO CLOCK vs SEGUNDA CHANCE ===\n";
     
-    // Testa Clock
-    ClockAlgorithm tempClock(getPhysicalMemorySize(), false);
-    for (int page : sequence) {
-        tempClock.referencePage(page);
-    }
-    auto clockStats = tempClock.getStatistics();
+    // Uma unica passagem pela sequencia alimenta os dois algoritmos
+    ReplayEngine engine;
+    size_t clock = engine.addPolicy(ReplayPolicy::CLOCK, getPhysicalMemorySize());
+    size_t secondChance = engine.addPolicy(ReplayPolicy::SECOND_CHANCE, getPhysicalMemorySize());
+    engine.run(sequence);
     
-    // Testa Segunda Chance
-    SecondChanceAlgorithm tempSecondChance(getPhysicalMemorySize(), false);
-    for (int page : sequence) {
-        tempSecondChance.referencePage(page);
-    }
-    auto secondChanceStats = tempSecondChance.getStatistics();
+    const AlgorithmStatistics& clockStats = engine.getStatistics(clock);
+    const AlgorithmStatistics& secondChanceStats = engine.getStatistics(secondChance);
     
     // Exibe resultados
     std::cout << "Algoritmo Clock:        " << clockStats.pageFaults << " page faults\n";
@@ -426,6 +692,55 @@ void MemoryManager::compareClockWithSecondChance(const std::vector<int>& sequenc
         std::cout << "Ambos tiveram o mesmo desempenho!\n";
     }
     
-    std::cout << "Diferenca: " << abs(clockStats.pageFaults - secondChanceStats.pageFaults) 
-              << " page faults\n";
+    uint64_t difference = clockStats.pageFaults > secondChanceStats.pageFaults
+        ? clockStats.pageFaults - secondChanceStats.pageFaults
+        : secondChanceStats.pageFaults - clockStats.pageFaults;
+    std::cout << "Diferenca: " << difference << " page faults\n";
+}
+
+/**
+ * @brief Compara o Clock com o LRU exato
+ * 
+ * Alem do total de page faults, conta as referencias em que os dois
+ * discordam (hit em um e fault no outro): mede quanto as decisoes do
+ * Clock se afastam do LRU, mesmo quando os totais ficam proximos. As
+ * mascaras de hits de cada bloco do ReplayEngine sao comparadas assim
+ * que o bloco termina, sem guardar o resultado de cada referencia.
+ */
+void MemoryManager::compareClockWithLRU(const std::vector<int>& sequence) const {
+    std::cout << "\n=== COMPARACAO CLOCK vs LRU ===\n";
+    
+    ReplayEngine engine;
+    size_t clock = engine.addPolicy(ReplayPolicy::CLOCK, getPhysicalMemorySize());
+    size_t lru = engine.addPolicy(ReplayPolicy::LRU, getPhysicalMemorySize());
+    uint64_t divergent = 0;
+    
+    engine.setBlockObserver([&](size_t count, const std::vector<const uint8_t*>& hitMasks) {
+        for (size_t byte = 0; byte < (count + 7) / 8; ++byte) {
+            divergent += __builtin_popcount(hitMasks[clock][byte] ^ hitMasks[lru][byte]);
+        }
+    });
+    engine.run(sequence);
+    
+    const AlgorithmStatistics& clockStats = engine.getStatistics(clock);
+    const AlgorithmStatistics& lruStats = engine.getStatistics(lru);
+    
+    std::cout << "Algoritmo Clock: " << clockStats.pageFaults << " page faults\n";
+    std::cout << "Algoritmo LRU:   " << lruStats.pageFaults << " page faults\n";
+    
+    int64_t extra = static_cast<int64_t>(clockStats.pageFaults) -
+                    static_cast<int64_t>(lruStats.pageFaults);
+    std::cout << "Clock - LRU: " << extra << " page faults";
+    if (lruStats.pageFaults > 0) {
+        std::cout << std::fixed << std::setprecision(2) << " ("
+                  << (100.0 * extra / lruStats.pageFaults) << "%)";
+    }
+    std::cout << "\n";
+    
+    std::cout << "Referencias com resultado diferente: " << divergent;
+    if (!sequence.empty()) {
+        std::cout << std::fixed << std::setprecision(2) << " ("
+                  << (100.0 * divergent / sequence.size()) << "%)";
+    }
+    std::cout << "\n";
 }
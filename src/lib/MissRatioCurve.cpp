@@ -0,0 +1,171 @@
+#include "../include/MissRatioCurve.h"
+#include <unordered_map>
+#include <stdexcept>
+#include <utility>
+#include <algorithm>
+
+/**
+ * @brief Soma delta na posicao index
+ */
+void FenwickTree::add(size_t index, int delta) {
+    for (size_t i = index + 1; i < tree.size(); i += i & (~i + 1)) {
+        tree[i] += delta;
+    }
+}
+
+/**
+ * @brief Soma das posicoes [0, index]
+ */
+int FenwickTree::prefixSum(size_t index) const {
+    int sum = 0;
+    for (size_t i = index + 1; i > 0; i -= i & (~i + 1)) {
+        sum += tree[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief Soma das posicoes [from, to] (vazia se from > to)
+ */
+int FenwickTree::rangeSum(size_t from, size_t to) const {
+    if (from > to) {
+        return 0;
+    }
+    return prefixSum(to) - (from > 0 ? prefixSum(from - 1) : 0);
+}
+
+/**
+ * @brief Construtor
+ * @param maxFrames Maior tamanho de memoria da curva
+ */
+MissRatioCurve::MissRatioCurve(int maxFrames) : maxFrames(maxFrames) {
+    if (maxFrames <= 0) {
+        throw std::invalid_argument("Numero maximo de frames deve ser positivo");
+    }
+}
+
+/**
+ * @brief Converte o histograma de distancias em faults por tamanho
+ * @param histogram histogram[d] = referencias com distancia de pilha d (1..maxFrames)
+ * @param beyond Referencias com distancia > maxFrames ou primeiro acesso
+ */
+std::vector<uint64_t> MissRatioCurve::buildCurve(const std::vector<uint64_t>& histogram,
+                                                 uint64_t beyond) const {
+    // Com c frames, faltam as referencias com distancia > c
+    std::vector<uint64_t> faults(maxFrames);
+    uint64_t missing = beyond;
+    
+    for (int c = maxFrames; c >= 1; --c) {
+        faults[c - 1] = missing;
+        missing += histogram[c];
+    }
+    
+    return faults;
+}
+
+/**
+ * @brief Curva LRU em uma passagem
+ * 
+ * Cada pagina marca na Fenwick apenas a posicao do seu ultimo acesso.
+ * A distancia de pilha de uma referencia e o numero de marcas entre o
+ * acesso anterior e o atual, mais um.
+ */
+std::vector<uint64_t> MissRatioCurve::computeLRU(const int* sequence, size_t length) const {
+    std::vector<uint64_t> histogram(maxFrames + 1, 0);
+    uint64_t beyond = 0;
+    FenwickTree marks(length);
+    std::unordered_map<int, size_t> lastAccess;
+    lastAccess.reserve(1024);
+    
+    for (size_t t = 0; t < length; ++t) {
+        auto it = lastAccess.find(sequence[t]);
+        
+        if (it == lastAccess.end()) {
+            beyond++;   // Primeiro acesso: fault em qualquer tamanho
+            lastAccess.emplace(sequence[t], t);
+        } else {
+            size_t previous = it->second;
+            int distance = marks.rangeSum(previous + 1, t) + 1;
+            
+            if (distance <= maxFrames) {
+                histogram[distance]++;
+            } else {
+                beyond++;
+            }
+            
+            marks.add(previous, -1);
+            it->second = t;
+        }
+        
+        marks.add(t, 1);
+    }
+    
+    return buildCurve(histogram, beyond);
+}
+
+/**
+ * @brief Curva OPT em uma passagem
+ * 
+ * A pilha mantem no topo as paginas de maior prioridade (proximo uso mais
+ * cedo). A pagina referenciada sobe ao topo e, nas posicoes acima da sua
+ * posicao anterior, a de proximo uso mais distante desce um nivel. O
+ * conteudo das c primeiras posicoes e exatamente a memoria do algoritmo
+ * otimo com c frames.
+ * 
+ * As maxFrames primeiras posicoes so dependem das posicoes acima delas,
+ * entao a pilha e limitada a maxFrames: a pagina que desceria alem do
+ * limite e descartada, e uma pagina fora da pilha tem distancia maior
+ * que maxFrames. Cada referencia custa O(maxFrames), qualquer que seja
+ * o numero de paginas distintas do trace.
+ */
+std::vector<uint64_t> MissRatioCurve::computeOptimal(const int* sequence, size_t length) const {
+    std::vector<uint64_t> histogram(maxFrames + 1, 0);
+    uint64_t beyond = 0;
+    
+    // Passagem de tras para frente: proximo uso de cada referencia
+    std::vector<size_t> nextUse(length);
+    std::unordered_map<int, size_t> seen;
+    for (size_t i = length; i-- > 0;) {
+        auto it = seen.find(sequence[i]);
+        nextUse[i] = it != seen.end() ? it->second : length;
+        seen[sequence[i]] = i;
+    }
+    
+    // Pilha de (pagina, proximo uso); indice 0 = topo
+    std::vector<std::pair<int, size_t>> stack;
+    stack.reserve(maxFrames);
+    
+    for (size_t t = 0; t < length; ++t) {
+        int page = sequence[t];
+        size_t depth = 0;
+        while (depth < stack.size() && stack[depth].first != page) {
+            ++depth;
+        }
+        
+        if (depth < stack.size()) {
+            histogram[depth + 1]++;
+        } else {
+            // Primeiro acesso ou distancia maior que maxFrames
+            beyond++;
+            if (stack.size() < static_cast<size_t>(maxFrames)) {
+                stack.emplace_back();
+            }
+        }
+        
+        // Desce o antigo topo: em cada nivel acima da posicao antiga fica a
+        // pagina de uso mais proximo, e a outra segue descendo
+        std::pair<int, size_t> carried = stack[0];
+        stack[0] = std::make_pair(page, nextUse[t]);
+        
+        if (depth > 0) {
+            size_t bottom = std::min(depth, stack.size() - 1);
+            for (size_t i = 1; i <= bottom; ++i) {
+                if (i == depth || carried.second < stack[i].second) {
+                    std::swap(carried, stack[i]);
+                }
+            }
+        }
+    }
+    
+    return buildCurve(histogram, beyond);
+}
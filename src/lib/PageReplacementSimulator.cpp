@@ -21,10 +21,10 @@ void PageReplacementSimulator::updateMemoryManager() {
 /**
  * @brief Converte string em sequência de números
  */
-std::vector<int> PageReplacementSimulator::parseSequence(const std::string& input) {
-    std::vector<int> sequence;
+std::vector<int64_t> PageReplacementSimulator::parseSequence(const std::string& input) {
+    std::vector<int64_t> sequence;
     std::istringstream iss(input);
-    int page;
+    int64_t page;
     
     while (iss >> page) {
         sequence.push_back(page);
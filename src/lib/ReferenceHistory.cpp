@@ -0,0 +1,47 @@
+#include "../include/ReferenceHistory.h"
+#include <sstream>
+
+/**
+ * @brief Monta a descricao textual do registro (sob demanda)
+ */
+std::string ReferenceRecord::describe() const {
+    if (getResult() == ReferenceResult::INVALID) {
+        return "Numero de pagina invalido";
+    }
+    
+    std::stringstream desc;
+    desc << "Pagina " << pageNumber << " - ";
+    if (getResult() == ReferenceResult::HIT) {
+        desc << "HIT";
+    } else {
+        desc << "MISS (Page Fault)";
+        if (evictedPage != -1) {
+            desc << " - substituiu pagina " << evictedPage;
+        }
+    }
+    return desc.str();
+}
+
+/**
+ * @brief Construtor
+ * @param capacity Numero maximo de registros (0 desabilita o historico)
+ */
+ReferenceHistory::ReferenceHistory(size_t capacity)
+    : records(capacity), capacity(capacity), head(0), count(0) {}
+
+/**
+ * @brief Altera a capacidade, mantendo os registros mais recentes
+ */
+void ReferenceHistory::setCapacity(size_t newCapacity) {
+    std::vector<ReferenceRecord> kept(newCapacity);
+    size_t keep = count < newCapacity ? count : newCapacity;
+    
+    for (size_t i = 0; i < keep; ++i) {
+        kept[i] = (*this)[count - keep + i];
+    }
+    
+    records.swap(kept);
+    capacity = newCapacity;
+    head = 0;
+    count = keep;
+}
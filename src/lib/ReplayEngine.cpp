@@ -0,0 +1,252 @@
+#include "../include/ReplayEngine.h"
+#include "../include/MemoryManager.h"
+#include <chrono>
+#include <algorithm>
+
+/**
+ * @brief Processa referencia a referencia, marcando os hits pela variacao
+ *        dos page faults (FIFO e Otimo)
+ */
+void PolicySimulator::processWithHits(const int* pages, size_t count, uint8_t* hitMask) {
+    std::fill(hitMask, hitMask + (count + 7) / 8, 0);
+    
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t faults = getStatistics().pageFaults;
+        process(pages + i, 1);
+        if (getStatistics().pageFaults == faults) {
+            hitMask[i >> 3] |= static_cast<uint8_t>(1u << (i & 7));
+        }
+    }
+}
+
+/**
+ * @brief Algoritmo da hierarquia PageReplacementAlgorithm (Clock, Segunda
+ *        Chance, LRU ou Aging)
+ */
+class AlgorithmPolicy : public PolicySimulator {
+private:
+    std::unique_ptr<PageReplacementAlgorithm> algorithm;
+
+public:
+    explicit AlgorithmPolicy(std::unique_ptr<PageReplacementAlgorithm> algorithm)
+        : algorithm(std::move(algorithm)) {}
+    
+    void process(const int* pages, size_t count) override {
+        algorithm->referencePages(pages, count);
+    }
+    
+    void processWithHits(const int* pages, size_t count, uint8_t* hitMask) override {
+        algorithm->referencePages(pages, count, hitMask);
+    }
+    
+    const AlgorithmStatistics& getStatistics() const override {
+        return algorithm->getStatistics();
+    }
+};
+
+/**
+ * @brief ARC ou CAR: expoe tambem o historico do alvo p
+ */
+template <typename Algorithm>
+class AdaptivePolicy : public PolicySimulator {
+private:
+    Algorithm algorithm;
+
+public:
+    explicit AdaptivePolicy(int frames) : algorithm(frames, false) {}
+    
+    void process(const int* pages, size_t count) override {
+        algorithm.referencePages(pages, count);
+    }
+    
+    void processWithHits(const int* pages, size_t count, uint8_t* hitMask) override {
+        algorithm.referencePages(pages, count, hitMask);
+    }
+    
+    const AlgorithmStatistics& getStatistics() const override {
+        return algorithm.getStatistics();
+    }
+    
+    const TargetHistory* getTargetHistory() const override {
+        return &algorithm.getTargetHistory();
+    }
+};
+
+/**
+ * @brief FIFO (FIFOSimulator incremental)
+ */
+class FIFOPolicy : public PolicySimulator {
+private:
+    FIFOSimulator fifo;
+    AlgorithmStatistics stats;
+
+public:
+    explicit FIFOPolicy(int frames) : fifo(frames) {}
+    
+    void process(const int* pages, size_t count) override {
+        uint64_t faults = fifo.process(pages, count);
+        stats.totalReferences += count;
+        stats.pageFaults += faults;
+        stats.hits += count - faults;
+    }
+    
+    const AlgorithmStatistics& getStatistics() const override { return stats; }
+};
+
+/**
+ * @brief Otimo (Belady): precisa do trace inteiro para o proximo uso
+ */
+class OptimalPolicy : public PolicySimulator {
+private:
+    OptimalSimulator optimal;
+    AlgorithmStatistics stats;
+
+public:
+    explicit OptimalPolicy(int frames) : optimal(frames) {}
+    
+    void prepare(const int* pages, size_t count) override {
+        optimal.prepare(pages, count);
+        stats.reset();
+    }
+    
+    void process(const int* pages, size_t count) override {
+        uint64_t faults = optimal.process(pages, count);
+        stats.totalReferences += count;
+        stats.pageFaults += faults;
+        stats.hits += count - faults;
+    }
+    
+    const AlgorithmStatistics& getStatistics() const override { return stats; }
+    bool needsFullTrace() const override { return true; }
+};
+
+/**
+ * @brief Cria a politica pronta para consumir blocos
+ */
+std::unique_ptr<PolicySimulator> PolicyFactory::create(ReplayPolicy policy, int frames) {
+    switch (policy) {
+        case ReplayPolicy::CLOCK:
+        case ReplayPolicy::SECOND_CHANCE:
+        case ReplayPolicy::LRU:
+        case ReplayPolicy::AGING:
+            return std::unique_ptr<PolicySimulator>(
+                new AlgorithmPolicy(createAlgorithm(policy, frames, false)));
+        case ReplayPolicy::ARC:
+            return std::unique_ptr<PolicySimulator>(new AdaptivePolicy<ARCAlgorithm>(frames));
+        case ReplayPolicy::CAR:
+            return std::unique_ptr<PolicySimulator>(new AdaptivePolicy<CARAlgorithm>(frames));
+        case ReplayPolicy::FIFO:
+            return std::unique_ptr<PolicySimulator>(new FIFOPolicy(frames));
+        case ReplayPolicy::OPTIMAL:
+            return std::unique_ptr<PolicySimulator>(new OptimalPolicy(frames));
+    }
+    throw std::invalid_argument("Politica desconhecida");
+}
+
+/**
+ * @brief Cria um algoritmo da hierarquia PageReplacementAlgorithm
+ */
+std::unique_ptr<PageReplacementAlgorithm> PolicyFactory::createAlgorithm(ReplayPolicy policy,
+                                                                          int frames, bool debug) {
+    switch (policy) {
+        case ReplayPolicy::CLOCK:
+            return std::unique_ptr<PageReplacementAlgorithm>(new ClockAlgorithm(frames, debug));
+        case ReplayPolicy::SECOND_CHANCE:
+            return std::unique_ptr<PageReplacementAlgorithm>(new SecondChanceAlgorithm(frames, debug));
+        case ReplayPolicy::LRU:
+            return std::unique_ptr<PageReplacementAlgorithm>(new LRUAlgorithm(frames, debug));
+        case ReplayPolicy::AGING:
+            return std::unique_ptr<PageReplacementAlgorithm>(new AgingAlgorithm(frames, debug));
+        case ReplayPolicy::ARC:
+            return std::unique_ptr<PageReplacementAlgorithm>(new ARCAlgorithm(frames, debug));
+        case ReplayPolicy::CAR:
+            return std::unique_ptr<PageReplacementAlgorithm>(new CARAlgorithm(frames, debug));
+        default:
+            throw std::invalid_argument("Algoritmo " + TraceReplay::getPolicyName(policy) +
+                                        " nao implementa PageReplacementAlgorithm");
+    }
+}
+
+/**
+ * @brief Construtor
+ * @param blockSize Referencias entregues a cada politica por vez
+ */
+ReplayEngine::ReplayEngine(size_t blockSize) : blockSize(std::max<size_t>(blockSize, 1)) {}
+
+/**
+ * @brief Registra uma politica com o numero de frames informado
+ * @return Indice da politica nos resultados
+ */
+size_t ReplayEngine::addPolicy(ReplayPolicy policy, int frames) {
+    Entry entry;
+    entry.policy = policy;
+    entry.frames = frames;
+    entry.simulator = PolicyFactory::create(policy, frames);
+    entry.seconds = 0.0;
+    entries.push_back(std::move(entry));
+    return entries.size() - 1;
+}
+
+/**
+ * @brief Define o observador que recebe as mascaras de hits de cada bloco
+ */
+void ReplayEngine::setBlockObserver(BlockObserver blockObserver) {
+    observer = std::move(blockObserver);
+}
+
+/**
+ * @brief Indica se nenhuma politica registrada precisa do trace inteiro
+ */
+bool ReplayEngine::supportsStreaming() const {
+    return std::none_of(entries.begin(), entries.end(),
+                        [](const Entry& entry) { return entry.simulator->needsFullTrace(); });
+}
+
+/**
+ * @brief Executa todas as politicas sobre um trace completo
+ */
+void ReplayEngine::run(const int* pages, size_t count) {
+    for (auto& entry : entries) {
+        auto start = std::chrono::steady_clock::now();
+        entry.simulator->prepare(pages, count);
+        auto end = std::chrono::steady_clock::now();
+        entry.seconds += std::chrono::duration<double>(end - start).count();
+    }
+    
+    processBlocks(pages, count);
+}
+
+/**
+ * @brief Entrega cada bloco a todas as politicas, em ordem
+ * 
+ * Com observador, as politicas preenchem a mascara de hits do bloco e o
+ * observador a recebe antes do proximo bloco.
+ */
+void ReplayEngine::processBlocks(const int* pages, size_t count) {
+    std::vector<const uint8_t*> hitMasks;
+    if (observer) {
+        for (auto& entry : entries) {
+            entry.hitMask.resize((blockSize + 7) / 8);
+            hitMasks.push_back(entry.hitMask.data());
+        }
+    }
+    
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        size_t n = std::min(blockSize, count - offset);
+        
+        for (auto& entry : entries) {
+            auto start = std::chrono::steady_clock::now();
+            if (observer) {
+                entry.simulator->processWithHits(pages + offset, n, entry.hitMask.data());
+            } else {
+                entry.simulator->process(pages + offset, n);
+            }
+            auto end = std::chrono::steady_clock::now();
+            entry.seconds += std::chrono::duration<double>(end - start).count();
+        }
+        
+        if (observer) {
+            observer(n, hitMasks);
+        }
+    }
+}
@@ -1,49 +1,60 @@
 #include "../include/SecondChanceAlgorithm.h"
+#include "../include/Logger.h"
+#include <algorithm>
 
 /**
  * @brief Construtor do algoritmo Segunda Chance
  */
 SecondChanceAlgorithm::SecondChanceAlgorithm(int size, bool debug)
-    : PageReplacementAlgorithm(size, debug) {
+    : PageReplacementAlgorithm(size, debug), head(0), count(0) {
     
     if (size <= 0) {
         throw std::invalid_argument("Tamanho da memoria deve ser positivo");
     }
     
-    memory.reserve(size);
+    memory.resize(size);
+    pageTable.reserve(size);
 }
 
 /**
  * @brief Encontra uma pagina na memoria
  * @param pageNumber Numero da pagina a procurar
- * @return Indice da pagina ou -1 se nao encontrada
+ * @return Posicao da pagina na lista ou -1 se nao encontrada
  */
 int SecondChanceAlgorithm::findPage(int pageNumber) const {
-    for (size_t i = 0; i < memory.size(); ++i) {
-        if (memory[i].pageNumber == pageNumber) {
-            return static_cast<int>(i);
-        }
-    }
-    return -1;
+    int slot = pageTable.find(pageNumber);
+    return slot != -1 ? positionOf(slot) : -1;
 }
 
 /**
  * @brief Move uma pagina para o final da lista (segunda chance)
- * @param index Indice da pagina a mover
+ * @param index Posicao da pagina a mover
+ * 
+ * Com a lista cheia, mover o inicio para o final e apenas avancar head.
+ * Outras posicoes deslocam as paginas seguintes, como o erase faria.
  */
 void SecondChanceAlgorithm::moveToEnd(int index) {
-    if (index < 0 || index >= static_cast<int>(memory.size())) {
+    if (index < 0 || index >= count) {
         return;
     }
     
-    // Salva a pagina
-    SecondChancePage page = memory[index];
+    if (index == 0 && count == memorySize) {
+        head = slotAt(1);
+        return;
+    }
     
-    // Remove da posicao atual
-    memory.erase(memory.begin() + index);
+    // Salva a pagina e desloca as seguintes uma posicao para tras
+    PackedFrame page = memory[slotAt(index)];
+    for (int i = index; i < count - 1; ++i) {
+        int slot = slotAt(i);
+        memory[slot] = memory[slotAt(i + 1)];
+        pageTable.insert(memory[slot].getPage(), slot);
+    }
     
     // Adiciona no final
-    memory.push_back(page);
+    int last = slotAt(count - 1);
+    memory[last] = page;
+    pageTable.insert(page.getPage(), last);
 }
 
 /**
@@ -52,11 +63,12 @@ void SecondChanceAlgorithm::moveToEnd(int index) {
 void SecondChanceAlgorithm::displayMemoryState() const {
     std::cout << "Memoria: ";
     
-    for (size_t i = 0; i < static_cast<size_t>(memorySize); ++i) {
+    for (int i = 0; i < memorySize; ++i) {
         std::cout << "[";
-        if (i < memory.size() && memory[i].pageNumber != -1) {
-            std::cout << std::setw(2) << memory[i].pageNumber;
-            if (memory[i].referenceBit) {
+        if (i < count) {
+            const PackedFrame& page = memory[slotAt(i)];
+            std::cout << std::setw(2) << page.getPage();
+            if (page.getReferenceBit()) {
                 std::cout << "*";
             } else {
                 std::cout << " ";
@@ -77,12 +89,79 @@ void SecondChanceAlgorithm::displayMemory() const {
     displayMemoryState();
 }
 
+/**
+ * @brief Núcleo do algoritmo Segunda Chance, sem mensagens de debug
+ * @param pageNumber Número da página a referenciar
+ * @return true se houve page fault, false se foi hit
+ */
+inline bool SecondChanceAlgorithm::touchPage(int pageNumber) {
+    stats.totalReferences++;
+    
+    int hitSlot = pageTable.find(pageNumber);
+    if (hitSlot != -1) {
+        stats.hits++;
+        memory[hitSlot].setReferenceBit();
+        lastEvictedPage = -1;
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_HIT, "second-chance",
+                    stats.totalReferences, pageNumber, hitSlot);
+        return false;
+    }
+    
+    stats.pageFaults++;
+    
+    if (count < memorySize) {
+        int slot = slotAt(count);
+        memory[slot] = PackedFrame(pageNumber);
+        pageTable.insert(pageNumber, slot);
+        count++;
+        lastEvictedPage = -1;
+        Logger::log(LogLevel::TRACE, LogEventType::PAGE_FAULT, "second-chance",
+                    stats.totalReferences, pageNumber, slot);
+        return true;
+    }
+    
+    // Lista cheia: cada segunda chance apenas avança o início
+    while (memory[head].getReferenceBit()) {
+        memory[head].clearReferenceBit();
+        Logger::log(LogLevel::TRACE, LogEventType::SECOND_CHANCE, "second-chance",
+                    stats.totalReferences, memory[head].getPage(), head);
+        head = slotAt(1);
+    }
+    
+    // A pagina nova entra no fim da fila: com a lista cheia, o slot da
+    // vitima passa a ser o ultimo ao avancar o inicio
+    int slot = head;
+    lastEvictedPage = memory[slot].getPage();
+    pageTable.erase(lastEvictedPage);
+    memory[slot] = PackedFrame(pageNumber);
+    pageTable.insert(pageNumber, slot);
+    head = slotAt(1);
+    Logger::log(LogLevel::TRACE, LogEventType::PAGE_FAULT, "second-chance",
+                stats.totalReferences, pageNumber, slot);
+    Logger::log(LogLevel::DEBUG, LogEventType::PAGE_EVICTED, "second-chance",
+                stats.totalReferences, pageNumber, slot, lastEvictedPage);
+    return true;
+}
+
+/**
+ * @brief Processa um lote de referências em um laço sem despacho virtual
+ */
+const AlgorithmStatistics& SecondChanceAlgorithm::referencePages(const int* pages, size_t n,
+                                                                 uint8_t* outHitMask) {
+    return replayBatch(pages, n, outHitMask,
+                       [this](int page) { return touchPage(page); });
+}
+
 /**
  * @brief Referencia uma página (método principal do algoritmo)
  * @param pageNumber Número da página a referenciar
  * @return true se houve page fault, false se foi hit
  */
 bool SecondChanceAlgorithm::referencePage(int pageNumber) {
+    if (!debugMode) {
+        return touchPage(pageNumber);
+    }
+    
     stats.totalReferences++;
     
     if (debugMode) {
@@ -96,7 +175,8 @@ bool SecondChanceAlgorithm::referencePage(int pageNumber) {
     if (pageIndex != -1) {
         // PAGE HIT: página encontrada
         stats.hits++;
-        memory[pageIndex].referenceBit = true;  // Ativa bit de referência
+        memory[slotAt(pageIndex)].setReferenceBit();  // Ativa bit de referência
+        lastEvictedPage = -1;
         
         if (debugMode) {
             std::cout << "HIT: Pagina " << pageNumber << " encontrada na posicao " 
@@ -116,11 +196,15 @@ bool SecondChanceAlgorithm::referencePage(int pageNumber) {
     }
     
     // Se memória não está cheia, simplesmente adiciona
-    if (static_cast<int>(memory.size()) < memorySize) {
-        memory.push_back(SecondChancePage(pageNumber));
+    if (count < memorySize) {
+        int slot = slotAt(count);
+        memory[slot] = PackedFrame(pageNumber);
+        pageTable.insert(pageNumber, slot);
+        count++;
+        lastEvictedPage = -1;
         
         if (debugMode) {
-            std::cout << "Adicionada na posição " << (memory.size() - 1) << "\n";
+            std::cout << "Adicionada na posição " << (count - 1) << "\n";
             displayMemoryState();
             std::cout << "\n";
         }
@@ -131,24 +215,29 @@ bool SecondChanceAlgorithm::referencePage(int pageNumber) {
     // Memória cheia: aplicar algoritmo Segunda Chance
     while (true) {
         // Verifica a primeira página da lista
-        if (!memory[0].referenceBit) {
+        PackedFrame& first = memory[head];
+        if (!first.getReferenceBit()) {
             // Bit = 0: substitui esta página
             if (debugMode) {
-                std::cout << "Substituindo pagina " << memory[0].pageNumber 
+                std::cout << "Substituindo pagina " << first.getPage() 
                           << " (bit=0) por " << pageNumber << "\n";
             }
             
-            memory[0] = SecondChancePage(pageNumber);
+            lastEvictedPage = first.getPage();
+            pageTable.erase(first.getPage());
+            first = PackedFrame(pageNumber);
+            pageTable.insert(pageNumber, head);
+            moveToEnd(0);                // Pagina nova vai para o final da fila
             break;
         } else {
             // Bit = 1: dá segunda chance
             if (debugMode) {
-                std::cout << "Segunda chance para pagina " << memory[0].pageNumber 
+                std::cout << "Segunda chance para pagina " << first.getPage() 
                           << " (bit=1->0, movendo para o final)\n";
             }
             
-            memory[0].referenceBit = false;  // Limpa bit
-            moveToEnd(0);                    // Move para o final
+            first.clearReferenceBit();   // Limpa bit
+            moveToEnd(0);                // Move para o final
         }
     }
     
@@ -164,7 +253,11 @@ bool SecondChanceAlgorithm::referencePage(int pageNumber) {
  * @brief Reseta o algoritmo
  */
 void SecondChanceAlgorithm::reset() {
-    memory.clear();
+    memory.assign(memorySize, PackedFrame());
+    pageTable.clear();
+    head = 0;
+    count = 0;
+    lastEvictedPage = -1;
     stats.reset();
     
     if (debugMode) {
@@ -178,10 +271,9 @@ void SecondChanceAlgorithm::reset() {
  */
 std::vector<int> SecondChanceAlgorithm::getCurrentPages() const {
     std::vector<int> pages;
-    for (const auto& page : memory) {
-        if (page.pageNumber != -1) {
-            pages.push_back(page.pageNumber);
-        }
+    pages.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        pages.push_back(memory[slotAt(i)].getPage());
     }
     return pages;
 }
@@ -191,5 +283,5 @@ std::vector<int> SecondChanceAlgorithm::getCurrentPages() const {
  * @return true se cheia, false caso contrário
  */
 bool SecondChanceAlgorithm::isMemoryFull() const {
-    return static_cast<int>(memory.size()) >= memorySize;
+    return count >= memorySize;
 }
@@ -0,0 +1,189 @@
+#include "../include/ShardedClock.h"
+#include "../include/WorkStealingPool.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+// Frames movidos por rebalanceamento: 1/64 da cota media de um shard
+static const int MIGRATION_DIVISOR = 64;
+
+/**
+ * @brief Construtor do Clock particionado
+ * @param frames Total de frames, dividido igualmente entre os shards
+ * @param opts Numero de shards, threads e epoca de rebalanceamento
+ */
+ShardedClock::ShardedClock(int frames, const ShardOptions& opts)
+    : memorySize(frames), options(opts), migratedFrames(0) {
+    
+    if (frames <= 0) {
+        throw std::invalid_argument("Tamanho da memoria deve ser positivo");
+    }
+    if (options.shards <= 0 || options.minFrames <= 0) {
+        throw std::invalid_argument("Numero de shards e cota minima devem ser positivos");
+    }
+    if (frames < options.shards * options.minFrames) {
+        throw std::invalid_argument("Frames insuficientes para " + std::to_string(options.shards) +
+                                    " shards");
+    }
+    
+    shards.resize(options.shards);
+    for (int s = 0; s < options.shards; ++s) {
+        int quota = frames / options.shards + (s < frames % options.shards ? 1 : 0);
+        shards[s].clock.reset(new ClockAlgorithm(quota, false));
+        shards[s].epochStart = 0;
+        shards[s].framesReceived = 0;
+        shards[s].framesDonated = 0;
+    }
+}
+
+/**
+ * @brief Volta ao estado inicial (memoria vazia, cotas iguais)
+ */
+void ShardedClock::reset() {
+    int shardCount = static_cast<int>(shards.size());
+    for (int s = 0; s < shardCount; ++s) {
+        Shard& shard = shards[s];
+        shard.clock->reset();
+        shard.clock->resize(memorySize / shardCount + (s < memorySize % shardCount ? 1 : 0));
+        shard.pending.clear();
+        shard.epochStart = 0;
+        shard.framesReceived = 0;
+        shard.framesDonated = 0;
+    }
+    migratedFrames = 0;
+}
+
+/**
+ * @brief Move frames do shard com menos faults na epoca para o com mais
+ *
+ * So migra se a diferenca passar de 1/8 dos faults do mais pressionado,
+ * para que o ruido entre epocas nao faca frames irem e voltarem. O shard
+ * que cede escolhe as paginas que saem pelo proprio relogio.
+ */
+void ShardedClock::rebalance() {
+    int receiver = -1;
+    int donor = -1;
+    uint64_t mostFaults = 0;
+    uint64_t fewestFaults = 0;
+    std::vector<uint64_t> faults(shards.size());
+    
+    for (size_t s = 0; s < shards.size(); ++s) {
+        uint64_t total = shards[s].clock->getStatistics().pageFaults;
+        faults[s] = total - shards[s].epochStart;
+        shards[s].epochStart = total;
+        
+        if (receiver < 0 || faults[s] > mostFaults) {
+            receiver = static_cast<int>(s);
+            mostFaults = faults[s];
+        }
+    }
+    for (size_t s = 0; s < shards.size(); ++s) {
+        if (static_cast<int>(s) == receiver ||
+            shards[s].clock->getMemorySize() <= options.minFrames) {
+            continue;
+        }
+        if (donor < 0 || faults[s] < fewestFaults) {
+            donor = static_cast<int>(s);
+            fewestFaults = faults[s];
+        }
+    }
+    
+    if (donor < 0 || mostFaults - fewestFaults <= mostFaults / 8) {
+        return;
+    }
+    
+    ClockAlgorithm& from = *shards[donor].clock;
+    ClockAlgorithm& to = *shards[receiver].clock;
+    int step = std::max(1, memorySize / (static_cast<int>(shards.size()) * MIGRATION_DIVISOR));
+    step = std::min(step, from.getMemorySize() - options.minFrames);
+    
+    from.resize(from.getMemorySize() - step);
+    to.resize(to.getMemorySize() + step);
+    shards[donor].framesDonated += step;
+    shards[receiver].framesReceived += step;
+    migratedFrames += step;
+}
+
+/**
+ * @brief Replay do trace sobre os shards
+ * @param pages Trace (paginas >= 0)
+ * @param count Numero de referencias
+ * @return Tempo de parede do replay
+ *
+ * Cada epoca e processada em paralelo: a thread t percorre as
+ * referencias da epoca, separa as dos seus shards (s % threads == t) e
+ * entrega cada lote ao ClockAlgorithm do shard de uma vez. Ao fim da
+ * epoca, com todas as threads paradas, as cotas sao rebalanceadas. Sem
+ * rebalanceamento as epocas tem o tamanho padrao e servem so para
+ * limitar os lotes.
+ */
+double ShardedClock::replay(const int* pages, size_t count) {
+    int shardCount = static_cast<int>(shards.size());
+    int threads = options.threadCount > 0 ? options.threadCount
+                                          : WorkStealingPool::getDefaultThreadCount();
+    threads = std::max(1, std::min(threads, shardCount));
+    size_t epoch = options.epochLength > 0 ? options.epochLength : ShardOptions().epochLength;
+    
+    for (auto& shard : shards) {
+        shard.pending.reserve(epoch / shardCount * 2);
+    }
+    
+    auto begin = std::chrono::steady_clock::now();
+    {
+        WorkStealingPool pool(threads);
+        
+        for (size_t first = 0; first < count; first += epoch) {
+            size_t last = std::min(count, first + epoch);
+            
+            for (int t = 0; t < threads; ++t) {
+                pool.submit([this, pages, first, last, t, threads, shardCount] {
+                    for (size_t i = first; i < last; ++i) {
+                        int shard = shardOf(pages[i], shardCount);
+                        if (shard % threads == t) {
+                            shards[shard].pending.push_back(pages[i]);
+                        }
+                    }
+                    for (int shard = t; shard < shardCount; shard += threads) {
+                        std::vector<int>& pending = shards[shard].pending;
+                        shards[shard].clock->referencePages(pending.data(), pending.size());
+                        pending.clear();
+                    }
+                });
+            }
+            pool.wait();
+            
+            if (options.epochLength > 0) {
+                rebalance();
+            }
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+/**
+ * @brief Soma as estatisticas de todos os shards
+ */
+AlgorithmStatistics ShardedClock::getStatistics() const {
+    AlgorithmStatistics total;
+    for (const auto& shard : shards) {
+        const AlgorithmStatistics& stats = shard.clock->getStatistics();
+        total.totalReferences += stats.totalReferences;
+        total.pageFaults += stats.pageFaults;
+        total.hits += stats.hits;
+    }
+    return total;
+}
+
+/**
+ * @brief Estatisticas, cota atual e migracoes de um shard
+ */
+ShardStatistics ShardedClock::getShardStatistics(int shard) const {
+    ShardStatistics result;
+    result.stats = shards[shard].clock->getStatistics();
+    result.frames = shards[shard].clock->getMemorySize();
+    result.framesReceived = shards[shard].framesReceived;
+    result.framesDonated = shards[shard].framesDonated;
+    return result;
+}
@@ -69,7 +69,11 @@ void SimulatorUI::showMainMenu(int physicalMemorySize, int virtualMemorySize,
     std::cout << "-----------------------------------------------------------\n";
     std::cout << "\nConfiguracao atual:\n";
     std::cout << "- Memoria Fisica: " << physicalMemorySize << " frames\n";
-    std::cout << "- Memoria Virtual: " << virtualMemorySize << " paginas\n";
+    if (virtualMemorySize == 0) {
+        std::cout << "- Memoria Virtual: esparsa (IDs de 64 bits)\n";
+    } else {
+        std::cout << "- Memoria Virtual: " << virtualMemorySize << " paginas\n";
+    }
     std::cout << "- Algoritmo: " << algorithmName << "\n";
     std::cout << "- Modo Debug: " << (debugMode ? "Ativado" : "Desativado") << "\n";
 }
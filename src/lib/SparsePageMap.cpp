@@ -0,0 +1,36 @@
+#include "../include/SparsePageMap.h"
+#include "../include/FrameStore.h"
+#include <stdexcept>
+
+/**
+ * @brief Registra o ID original de um novo ID denso
+ * 
+ * IDs densos precisam caber nos frames compactados (0..MAX_PAGE).
+ */
+void SparsePageMap::addPage(int64_t page) {
+    if (pageIds.size() > static_cast<size_t>(PackedFrame::MAX_PAGE)) {
+        index.erase(static_cast<uint64_t>(page));
+        throw std::runtime_error("Espaco esparso excede 2^31 - 1 paginas distintas");
+    }
+    pageIds.push_back(page);
+}
+
+/**
+ * @brief Esquece todas as paginas (os IDs densos recomecam em 0)
+ */
+void SparsePageMap::clear() {
+    index.clear();
+    pageIds.clear();
+}
+
+/**
+ * @brief Traduz um bloco de IDs de 64 bits para IDs densos
+ * @param pages IDs originais
+ * @param count Numero de IDs
+ * @param dense Recebe os IDs densos (count posicoes)
+ */
+void SparsePageMap::internAll(const int64_t* pages, size_t count, int* dense) {
+    for (size_t i = 0; i < count; ++i) {
+        dense[i] = intern(pages[i]);
+    }
+}
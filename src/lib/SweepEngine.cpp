@@ -0,0 +1,109 @@
+#include "../include/SweepEngine.h"
+#include "../include/WorkStealingPool.h"
+#include "../include/ReplayEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+/**
+ * @brief Construtor
+ */
+SweepEngine::SweepEngine(int threadCount)
+    : threadCount(threadCount > 0 ? threadCount : WorkStealingPool::getDefaultThreadCount()) {}
+
+/**
+ * @brief Custo relativo estimado de uma celula (usado so para ordenar)
+ */
+static double estimateCost(ReplayPolicy policy, int frames) {
+    // OPT usa um conjunto ordenado (log k); o Aging percorre os contadores
+    // a cada fault (vetorial); os demais sao O(1) por referencia
+    double cost = policy == ReplayPolicy::OPTIMAL ? 4.0 : policy == ReplayPolicy::AGING ? 2.0 : 1.0;
+    return cost * (1.0 + std::log2(static_cast<double>(frames)));
+}
+
+/**
+ * @brief Executa todas as combinacoes em paralelo
+ * @return Matriz com uma celula por (algoritmo, frames)
+ * 
+ * As celulas que consomem o trace em blocos sao divididas em ate
+ * threadCount grupos de custo parecido; cada grupo e um ReplayEngine que
+ * le o trace uma unica vez para todas as suas celulas. Cada celula do
+ * Otimo continua sendo uma tarefa propria: ela guarda o proximo uso de
+ * todo o trace (4 bytes por referencia) e seu custo vem do conjunto
+ * ordenado, nao da leitura do trace.
+ */
+SweepMatrix SweepEngine::run(const int* pages, size_t count,
+                             const std::vector<ReplayPolicy>& policies,
+                             const std::vector<int>& frameCounts) const {
+    SweepMatrix matrix;
+    matrix.policies = policies;
+    matrix.frameCounts = frameCounts;
+    matrix.cells.resize(policies.size() * frameCounts.size());
+    
+    std::vector<size_t> order(matrix.cells.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        SweepResult& cell = matrix.cells[i];
+        cell.policy = policies[i / frameCounts.size()];
+        cell.frames = frameCounts[i % frameCounts.size()];
+        order[i] = i;
+    }
+    
+    // Mais caras primeiro: cada celula vai para o grupo mais leve ate entao
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return estimateCost(matrix.cells[a].policy, matrix.cells[a].frames) >
+               estimateCost(matrix.cells[b].policy, matrix.cells[b].frames);
+    });
+    
+    size_t fused = std::count_if(order.begin(), order.end(), [&](size_t index) {
+        return TraceReplay::supportsStreaming(matrix.cells[index].policy);
+    });
+    std::vector<std::vector<size_t>> groups(std::min<size_t>(threadCount, fused));
+    std::vector<double> groupCost(groups.size(), 0.0);
+    std::vector<std::vector<size_t>> tasks;
+    
+    for (size_t index : order) {
+        const SweepResult& cell = matrix.cells[index];
+        if (!TraceReplay::supportsStreaming(cell.policy)) {
+            tasks.push_back(std::vector<size_t>(1, index));
+            continue;
+        }
+        size_t lightest = std::min_element(groupCost.begin(), groupCost.end()) - groupCost.begin();
+        groups[lightest].push_back(index);
+        groupCost[lightest] += estimateCost(cell.policy, cell.frames);
+    }
+    tasks.insert(tasks.end(), groups.begin(), groups.end());
+    
+    auto start = std::chrono::steady_clock::now();
+    {
+        WorkStealingPool pool(std::min<int>(threadCount, static_cast<int>(tasks.size())));
+        
+        for (const auto& task : tasks) {
+            std::vector<SweepResult*> cells;
+            for (size_t index : task) {
+                cells.push_back(&matrix.cells[index]);
+            }
+            
+            pool.submit([cells, pages, count] {
+                ReplayEngine engine;
+                for (SweepResult* cell : cells) {
+                    engine.addPolicy(cell->policy, cell->frames);
+                }
+                engine.run(pages, count);
+                
+                for (size_t i = 0; i < cells.size(); ++i) {
+                    cells[i]->stats = engine.getStatistics(i);
+                    cells[i]->wallSeconds = engine.getSeconds(i);
+                    if (const TargetHistory* history = engine.getTargetHistory(i)) {
+                        cells[i]->targetHistory = history->getSamples();
+                    }
+                }
+            });
+        }
+        
+        pool.wait();
+    }
+    auto end = std::chrono::steady_clock::now();
+    matrix.wallSeconds = std::chrono::duration<double>(end - start).count();
+    
+    return matrix;
+}
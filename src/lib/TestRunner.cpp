@@ -1,7 +1,7 @@
 #include "../include/TestRunner.h"
 #include "../include/SimulatorUI.h"
-#include "../include/ClockAlgorithm.h"
-#include "../include/SecondChanceAlgorithm.h"
+#include "../include/ReplayEngine.h"
+#include "../include/WorkloadGenerator.h"
 #include <iostream>
 #include <iomanip>
 
@@ -22,6 +22,10 @@ void TestRunner::runAllTests() {
     displaySectionHeader("COMPARACAO COMPLETA DOS ALGORITMOS");
     runComparisonTests();
     
+    // Clock vs LRU referencia a referencia
+    displaySectionHeader("DISTANCIA DO CLOCK AO LRU");
+    runClockLRUComparison();
+    
     displayFinalSummary();
     SimulatorUI::waitForUser();
 }
@@ -127,7 +131,8 @@ void TestRunner::runComparisonTests() {
         {1, 3, 5, 7, 2, 4, 6, 8, 1, 3, 5, 7},           // Intercalação complexa
         {10, 20, 30, 10, 40, 20, 50, 30, 10, 60},       // Reúso com interferência
         {1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7},           // Pivot com página 1
-        {2, 4, 6, 8, 10, 1, 3, 5, 7, 9, 2, 4, 6}        // Duas fases distintas
+        {2, 4, 6, 8, 10, 1, 3, 5, 7, 9, 2, 4, 6},       // Duas fases distintas
+        {0, 1, 2, 1, 3, 2}                              // Regressão da Segunda Chance
     };
     
     std::vector<std::string> testNames = {
@@ -142,34 +147,60 @@ void TestRunner::runComparisonTests() {
         "Intercalacao Complexa",
         "Reuso com Interferencia",
         "Pivot com Pagina 1",
-        "Duas Fases Distintas"
+        "Duas Fases Distintas",
+        "Regressao SC (2 frames)"
     };
     
+    // Frames de cada teste (0 = memoria configurada). A regressao e o
+    // contraexemplo do --fuzz (0 1 2 1 3) mais uma referencia a pagina
+    // que a Segunda Chance substituia por engano: so diverge com 2 frames
+    std::vector<int> testFrames(testSequences.size(), 0);
+    testFrames.back() = 2;
+    
     // Executar todos os testes e coletar resultados
-    std::vector<int> clockResults, secondChanceResults, optimalResults;
+    std::vector<uint64_t> clockResults, secondChanceResults, optimalResults;
+    std::vector<uint64_t> lruResults, agingResults, arcResults, carResults;
     
     for (size_t i = 0; i < testSequences.size(); ++i) {
-        // Testar Clock
-        ClockAlgorithm tempClock(memoryManager->getPhysicalMemorySize(), false);
-        for (int page : testSequences[i]) {
-            tempClock.referencePage(page);
-        }
-        clockResults.push_back(tempClock.getStatistics().pageFaults);
-        
-        // Testar Segunda Chance
-        SecondChanceAlgorithm tempSecondChance(memoryManager->getPhysicalMemorySize(), false);
-        for (int page : testSequences[i]) {
-            tempSecondChance.referencePage(page);
-        }
-        secondChanceResults.push_back(tempSecondChance.getStatistics().pageFaults);
+        // Todos os algoritmos em uma única passagem pela sequência
+        int frames = testFrames[i] > 0 ? testFrames[i] : memoryManager->getPhysicalMemorySize();
+        ReplayEngine engine;
+        size_t clock = engine.addPolicy(ReplayPolicy::CLOCK, frames);
+        size_t secondChance = engine.addPolicy(ReplayPolicy::SECOND_CHANCE, frames);
+        size_t optimal = engine.addPolicy(ReplayPolicy::OPTIMAL, frames);
+        size_t lru = engine.addPolicy(ReplayPolicy::LRU, frames);
+        size_t aging = engine.addPolicy(ReplayPolicy::AGING, frames);
+        size_t arc = engine.addPolicy(ReplayPolicy::ARC, frames);
+        size_t car = engine.addPolicy(ReplayPolicy::CAR, frames);
+        engine.run(testSequences[i]);
         
-        // Testar Algoritmo Ótimo
-        OptimalSimulator optimal(memoryManager->getPhysicalMemorySize());
-        optimalResults.push_back(optimal.simulate(testSequences[i]));
+        clockResults.push_back(engine.getStatistics(clock).pageFaults);
+        secondChanceResults.push_back(engine.getStatistics(secondChance).pageFaults);
+        optimalResults.push_back(engine.getStatistics(optimal).pageFaults);
+        lruResults.push_back(engine.getStatistics(lru).pageFaults);
+        agingResults.push_back(engine.getStatistics(aging).pageFaults);
+        arcResults.push_back(engine.getStatistics(arc).pageFaults);
+        carResults.push_back(engine.getStatistics(car).pageFaults);
     }
     
     // Exibir tabela comparativa
-    displayComparisonTable(testNames, testSequences, clockResults, secondChanceResults, optimalResults);
+    displayComparisonTable(testNames, testSequences, clockResults, secondChanceResults, optimalResults,
+                           lruResults, agingResults, arcResults, carResults);
+}
+
+/**
+ * @brief Compara Clock e LRU em uma carga zipf
+ * 
+ * As sequencias da tabela sao curtas demais para medir o quanto as
+ * decisoes do Clock se afastam do LRU; a carga sintetica tem 100000
+ * referencias com localidade, na memoria configurada.
+ */
+void TestRunner::runClockLRUComparison() {
+    const std::string spec = "zipf:length=100000,pages=1000,alpha=0.9,seed=1";
+    std::vector<int> sequence = WorkloadGenerator::materialize(WorkloadGenerator::parseSpec(spec));
+    
+    std::cout << "Carga: " << spec << " (" << memoryManager->getPhysicalMemorySize() << " frames)\n";
+    memoryManager->compareClockWithLRU(sequence);
 }
 
 /**
@@ -214,19 +245,19 @@ void TestRunner::displayFinalSummary() {
     std::cout << "CONCLUSOES DOS TESTES:\n";
     std::cout << "----------------------------------------\n\n";
     
-    std::cout << "1. CLOCK vs SECOND CHANCE - SIMILARIDADE ESPERADA:\n";
+    std::cout << "1. CLOCK vs SECOND CHANCE - DECISOES IDENTICAS:\n";
     std::cout << "   | Implementacao  : Ambos corretos e funcionais\n";
     std::cout << "   | Principio      : Mesmo conceito de \"segunda chance\"\n";
-    std::cout << "   | Diferenca      : Estrutura de dados (circular vs linear)\n";
-    std::cout << "   | Performance    : Clock O(1), Second Chance O(n)\n";
-    std::cout << "   | Page Faults    : Resultados muito similares (normal!)\n\n";
+    std::cout << "   | Diferenca      : Estrutura de dados (ponteiro vs fila em anel)\n";
+    std::cout << "   | Performance    : Ambos O(1) amortizado por referencia\n";
+    std::cout << "   | Page Faults    : Iguais em qualquer sequencia (empate)\n\n";
     
-    std::cout << "2. POR QUE RESULTADOS PODEM VARIAR:\n";
-    std::cout << "   | Clock          : Melhor em padroes regulares/previsiveis\n";
-    std::cout << "   | Second Chance  : Melhor em padroes complexos/irregulares\n";
-    std::cout << "   | Motivo         : Reordenacao dinamica vs estrutura fixa\n";
-    std::cout << "   | Exemplo        : Seq. basica (Clock+) vs Seq. complexa (SC+)\n";
-    std::cout << "   | Conclusao      : Cada algoritmo tem pontos fortes!\n\n";
+    std::cout << "2. POR QUE OS RESULTADOS SAO IGUAIS:\n";
+    std::cout << "   | Clock          : Ponteiro avanca e pula paginas com bit=1\n";
+    std::cout << "   | Second Chance  : Inicio da lista vai para o final se bit=1\n";
+    std::cout << "   | Motivo         : Lista a partir do inicio = frames a partir do ponteiro\n";
+    std::cout << "   | Verificacao    : simulator --fuzz N compara as vitimas a cada fault\n";
+    std::cout << "   | Conclusao      : Mesma politica, implementacoes diferentes\n\n";
     
     std::cout << "3. COMPARACAO COM ALGORITMO OTIMO:\n";
     std::cout << "   | Algoritmo Otimo: Define limite teorico superior\n";
@@ -234,15 +265,14 @@ void TestRunner::displayFinalSummary() {
     std::cout << "   | Gap            : Aceitavel para uso real\n\n";
     
     std::cout << "4. QUANDO USAR CADA ALGORITMO:\n";
-    std::cout << "   | Clock          : Sistemas com padroes regulares\n";
-    std::cout << "   | Second Chance  : Sistemas com acesso irregular/adaptativo\n";
-    std::cout << "   | Performance    : Clock geralmente mais rapido (O(1))\n";
-    std::cout << "   | Adaptabilidade : Second Chance mais flexivel\n";
-    std::cout << "   | Escolha        : Depende do padrao de acesso esperado\n\n";
+    std::cout << "   | Clock          : Uso real (sem mover paginas)\n";
+    std::cout << "   | Second Chance  : Didatico (fila FIFO explicita)\n";
+    std::cout << "   | Performance    : Ambos O(1); Clock varre os bits em palavras\n";
+    std::cout << "   | Escolha        : Mesmos page faults; decide o custo por referencia\n\n";
     
     std::cout << "===========================================\n";
     std::cout << "| Implementacao validada e funcionando!  |\n";
-    std::cout << "| Similaridade entre algoritmos e NORMAL |\n";
+    std::cout << "| Clock e Second Chance sempre empatam   |\n";
     std::cout << "===========================================\n\n";
 }
 
@@ -251,9 +281,13 @@ void TestRunner::displayFinalSummary() {
  */
 void TestRunner::displayComparisonTable(const std::vector<std::string>& testNames,
                                        const std::vector<std::vector<int>>& testSequences,
-                                       const std::vector<int>& clockResults,
-                                       const std::vector<int>& secondChanceResults,
-                                       const std::vector<int>& optimalResults) {
+                                       const std::vector<uint64_t>& clockResults,
+                                       const std::vector<uint64_t>& secondChanceResults,
+                                       const std::vector<uint64_t>& optimalResults,
+                                       const std::vector<uint64_t>& lruResults,
+                                       const std::vector<uint64_t>& agingResults,
+                                       const std::vector<uint64_t>& arcResults,
+                                       const std::vector<uint64_t>& carResults) {
     std::cout << "\n=== TABELA COMPARATIVA DE PAGE FAULTS ===\n\n";
     
     // Cabeçalho da tabela
@@ -261,9 +295,13 @@ void TestRunner::displayComparisonTable(const std::vector<std::string>& testName
               << std::setw(12) << "Clock"
               << std::setw(15) << "Second Chance"
               << std::setw(12) << "Otimo"
+              << std::setw(8) << "LRU"
+              << std::setw(8) << "Aging"
+              << std::setw(6) << "ARC"
+              << std::setw(6) << "CAR"
               << std::setw(15) << "Melhor Alg." << "\n";
     
-    std::cout << std::string(80, '-') << "\n";
+    std::cout << std::string(108, '-') << "\n";
     
     // Linhas da tabela
     for (size_t i = 0; i < testNames.size(); ++i) {
@@ -280,14 +318,19 @@ void TestRunner::displayComparisonTable(const std::vector<std::string>& testName
                   << std::setw(12) << clockResults[i]
                   << std::setw(15) << secondChanceResults[i]
                   << std::setw(12) << optimalResults[i]
+                  << std::setw(8) << lruResults[i]
+                  << std::setw(8) << agingResults[i]
+                  << std::setw(6) << arcResults[i]
+                  << std::setw(6) << carResults[i]
                   << std::setw(15) << bestAlgorithm << "\n";
     }
     
-    std::cout << std::string(80, '-') << "\n";
+    std::cout << std::string(108, '-') << "\n";
     
     // Estatísticas resumidas
     int clockWins = 0, secondChanceWins = 0, ties = 0;
     double clockTotal = 0, secondChanceTotal = 0, optimalTotal = 0;
+    double lruTotal = 0, agingTotal = 0, arcTotal = 0, carTotal = 0;
     
     for (size_t i = 0; i < clockResults.size(); ++i) {
         if (clockResults[i] < secondChanceResults[i]) {
@@ -301,6 +344,10 @@ void TestRunner::displayComparisonTable(const std::vector<std::string>& testName
         clockTotal += clockResults[i];
         secondChanceTotal += secondChanceResults[i];
         optimalTotal += optimalResults[i];
+        lruTotal += lruResults[i];
+        agingTotal += agingResults[i];
+        arcTotal += arcResults[i];
+        carTotal += carResults[i];
     }
     
     std::cout << "\n=== RESUMO ESTATISTICO ===\n";
@@ -311,6 +358,10 @@ void TestRunner::displayComparisonTable(const std::vector<std::string>& testName
     std::cout << "  - Clock            : " << (int)clockTotal << "\n";
     std::cout << "  - Second Chance    : " << (int)secondChanceTotal << "\n";
     std::cout << "  - Otimo            : " << (int)optimalTotal << "\n";
+    std::cout << "  - LRU              : " << (int)lruTotal << "\n";
+    std::cout << "  - Aging            : " << (int)agingTotal << "\n";
+    std::cout << "  - ARC              : " << (int)arcTotal << "\n";
+    std::cout << "  - CAR              : " << (int)carTotal << "\n";
     
     // Eficiência em relação ao ótimo
     double clockEfficiency = (optimalTotal / clockTotal) * 100.0;
@@ -321,6 +372,18 @@ void TestRunner::displayComparisonTable(const std::vector<std::string>& testName
               << clockEfficiency << "%\n";
     std::cout << "  - Second Chance    : " << std::fixed << std::setprecision(1) 
               << secondChanceEfficiency << "%\n";
+    std::cout << "  - LRU              : " << std::fixed << std::setprecision(1) 
+              << (optimalTotal / lruTotal) * 100.0 << "%\n";
+    std::cout << "  - Aging            : " << std::fixed << std::setprecision(1) 
+              << (optimalTotal / agingTotal) * 100.0 << "%\n";
+    std::cout << "  - ARC              : " << std::fixed << std::setprecision(1) 
+              << (optimalTotal / arcTotal) * 100.0 << "%\n";
+    std::cout << "  - CAR              : " << std::fixed << std::setprecision(1) 
+              << (optimalTotal / carTotal) * 100.0 << "%\n";
+    
+    // Distancia do Clock ao LRU que ele aproxima
+    std::cout << "Clock vs LRU         : " << std::showpos << (int)(clockTotal - lruTotal)
+              << std::noshowpos << " page faults\n";
     
     // Exibir sequências dos testes
     std::cout << "\n=== SEQUENCIAS DOS TESTES ===\n";
@@ -0,0 +1,209 @@
+#include "../include/TraceFile.h"
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+const char TraceFile::kMagic[8] = {'P', 'G', 'T', 'R', 'A', 'C', 'E', '\0'};
+
+/**
+ * @brief Verifica se o arquivo comeca com o magic do formato binario
+ */
+bool TraceFile::isBinaryTrace(const std::string& path) {
+    std::ifstream file(path.c_str(), std::ios::binary);
+    char magic[sizeof(kMagic)];
+    
+    if (!file.read(magic, sizeof(magic))) {
+        return false;
+    }
+    return std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+/**
+ * @brief Grava o cabecalho e os IDs de pagina com a largura informada
+ */
+static void writeTrace(const std::string& path, const void* pages, size_t count, uint32_t width) {
+    std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Nao foi possivel criar o trace: " + path);
+    }
+    
+    TraceFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, TraceFile::kMagic, sizeof(TraceFile::kMagic));
+    header.version = TraceFile::kVersion;
+    header.pageIdWidth = width;
+    header.referenceCount = count;
+    
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(static_cast<const char*>(pages), count * width);
+    
+    if (!file) {
+        throw std::runtime_error("Erro ao gravar o trace: " + path);
+    }
+}
+
+/**
+ * @brief Grava paginas no formato binario (IDs de 32 bits)
+ */
+void TraceFile::writeBinary(const std::string& path, const int* pages, size_t count) {
+    writeTrace(path, pages, count, sizeof(int));
+}
+
+/**
+ * @brief Grava paginas no formato binario (IDs de 64 bits, espaco esparso)
+ */
+void TraceFile::writeBinary(const std::string& path, const int64_t* pages, size_t count) {
+    writeTrace(path, pages, count, sizeof(int64_t));
+}
+
+/**
+ * @brief Valida o cabecalho contra o tamanho real do arquivo
+ */
+void TraceFile::validateHeader(const TraceFileHeader& header, size_t fileSize,
+                               const std::string& path) {
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("Arquivo nao e um trace binario: " + path);
+    }
+    if (header.version != kVersion) {
+        throw std::runtime_error("Versao de trace nao suportada: " + path);
+    }
+    if (header.pageIdWidth != sizeof(int) && header.pageIdWidth != sizeof(int64_t)) {
+        throw std::runtime_error("Largura de pagina nao suportada: " + path);
+    }
+    
+    uint64_t payload = fileSize - sizeof(TraceFileHeader);
+    if (header.referenceCount > payload / header.pageIdWidth) {
+        throw std::runtime_error("Trace truncado: " + path);
+    }
+}
+
+static_assert(sizeof(TraceFileHeader) == 32, "TraceFileHeader deve ter 32 bytes");
+
+/**
+ * @brief Construtor vazio (nenhum arquivo mapeado)
+ */
+MappedTrace::MappedTrace()
+    : mapping(nullptr), mappingSize(0), pages(nullptr), widePages(nullptr), referenceCount(0)
+#ifdef _WIN32
+    , fileHandle(nullptr), mappingHandle(nullptr)
+#endif
+{
+}
+
+/**
+ * @brief Construtor que ja mapeia o arquivo
+ */
+MappedTrace::MappedTrace(const std::string& path) : MappedTrace() {
+    open(path);
+}
+
+/**
+ * @brief Destrutor - desfaz o mapeamento
+ */
+MappedTrace::~MappedTrace() {
+    close();
+}
+
+/**
+ * @brief Mapeia um trace binario e valida o cabecalho
+ */
+void MappedTrace::open(const std::string& path) {
+    close();
+    
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Nao foi possivel abrir o trace: " + path);
+    }
+    
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)sizeof(TraceFileHeader)) {
+        CloseHandle(file);
+        throw std::runtime_error("Trace binario invalido: " + path);
+    }
+    
+    HANDLE view = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* base = view ? MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!base) {
+        if (view) CloseHandle(view);
+        CloseHandle(file);
+        throw std::runtime_error("Falha ao mapear o trace: " + path);
+    }
+    
+    fileHandle = file;
+    mappingHandle = view;
+    mappingSize = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Nao foi possivel abrir o trace: " + path);
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(TraceFileHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Trace binario invalido: " + path);
+    }
+    
+    void* base = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("Falha ao mapear o trace: " + path);
+    }
+    
+    // O replay percorre o trace em ordem: pede leitura antecipada ao kernel
+    madvise(base, info.st_size, MADV_SEQUENTIAL);
+    mappingSize = static_cast<size_t>(info.st_size);
+#endif
+    
+    mapping = base;
+    
+    const TraceFileHeader* header = static_cast<const TraceFileHeader*>(mapping);
+    try {
+        TraceFile::validateHeader(*header, mappingSize, path);
+    } catch (...) {
+        close();
+        throw;
+    }
+    
+    const char* payload = static_cast<const char*>(mapping) + sizeof(TraceFileHeader);
+    if (header->pageIdWidth == sizeof(int64_t)) {
+        widePages = reinterpret_cast<const int64_t*>(payload);
+    } else {
+        pages = reinterpret_cast<const int*>(payload);
+    }
+    referenceCount = static_cast<size_t>(header->referenceCount);
+}
+
+/**
+ * @brief Desfaz o mapeamento atual (se houver)
+ */
+void MappedTrace::close() {
+    if (mapping) {
+#ifdef _WIN32
+        UnmapViewOfFile(mapping);
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = nullptr;
+#else
+        munmap(mapping, mappingSize);
+#endif
+    }
+    
+    mapping = nullptr;
+    mappingSize = 0;
+    pages = nullptr;
+    widePages = nullptr;
+    referenceCount = 0;
+}
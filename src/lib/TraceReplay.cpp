@@ -0,0 +1,133 @@
+#include "../include/TraceReplay.h"
+#include "../include/ReplayEngine.h"
+#include "../include/TraceStream.h"
+#include "../include/WorkloadGenerator.h"
+#include <stdexcept>
+
+/**
+ * @brief Converte o nome usado na linha de comando em politica
+ * @return true se o nome for reconhecido
+ */
+bool TraceReplay::parsePolicy(const std::string& name, ReplayPolicy& policy) {
+    if (name == "clock") {
+        policy = ReplayPolicy::CLOCK;
+    } else if (name == "second-chance" || name == "sc") {
+        policy = ReplayPolicy::SECOND_CHANCE;
+    } else if (name == "fifo") {
+        policy = ReplayPolicy::FIFO;
+    } else if (name == "optimal" || name == "opt") {
+        policy = ReplayPolicy::OPTIMAL;
+    } else if (name == "lru") {
+        policy = ReplayPolicy::LRU;
+    } else if (name == "aging") {
+        policy = ReplayPolicy::AGING;
+    } else if (name == "arc") {
+        policy = ReplayPolicy::ARC;
+    } else if (name == "car") {
+        policy = ReplayPolicy::CAR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Nome canonico da politica (usado na saida CSV/JSON)
+ */
+std::string TraceReplay::getPolicyName(ReplayPolicy policy) {
+    switch (policy) {
+        case ReplayPolicy::CLOCK: return "clock";
+        case ReplayPolicy::SECOND_CHANCE: return "second-chance";
+        case ReplayPolicy::FIFO: return "fifo";
+        case ReplayPolicy::OPTIMAL: return "optimal";
+        case ReplayPolicy::LRU: return "lru";
+        case ReplayPolicy::AGING: return "aging";
+        case ReplayPolicy::ARC: return "arc";
+        case ReplayPolicy::CAR: return "car";
+        default: return "unknown";
+    }
+}
+
+/**
+ * @brief Lista todas as politicas suportadas
+ */
+std::vector<ReplayPolicy> TraceReplay::getAllPolicies() {
+    return {ReplayPolicy::CLOCK, ReplayPolicy::SECOND_CHANCE,
+            ReplayPolicy::FIFO, ReplayPolicy::OPTIMAL,
+            ReplayPolicy::LRU, ReplayPolicy::AGING,
+            ReplayPolicy::ARC, ReplayPolicy::CAR};
+}
+
+/**
+ * @brief Executa uma politica sobre o trace inteiro
+ */
+AlgorithmStatistics TraceReplay::replay(ReplayPolicy policy, int frames,
+                                        const std::vector<int>& pages) {
+    return replay(policy, frames, pages.data(), pages.size());
+}
+
+/**
+ * @brief Executa uma politica sobre uma visao do trace (ex.: MappedTrace)
+ */
+AlgorithmStatistics TraceReplay::replay(ReplayPolicy policy, int frames,
+                                        const int* pages, size_t count) {
+    std::unique_ptr<PolicySimulator> simulator = PolicyFactory::create(policy, frames);
+    simulator->prepare(pages, count);
+    simulator->process(pages, count);
+    return simulator->getStatistics();
+}
+
+/**
+ * @brief Indica se a politica pode consumir o trace bloco a bloco
+ */
+bool TraceReplay::supportsStreaming(ReplayPolicy policy) {
+    return policy != ReplayPolicy::OPTIMAL;
+}
+
+/**
+ * @brief Executa uma politica consumindo uma fonte de blocos
+ * @param source Objeto com nextChunk(const int*&, size_t&) (TraceStream,
+ *        WorkloadGenerator)
+ */
+template <typename ChunkSource>
+static AlgorithmStatistics replayChunks(ReplayPolicy policy, int frames, ChunkSource& source) {
+    if (!TraceReplay::supportsStreaming(policy)) {
+        throw std::invalid_argument("Algoritmo " + TraceReplay::getPolicyName(policy) + 
+                                    " precisa do trace completo (sem streaming)");
+    }
+    
+    ReplayEngine engine;
+    engine.addPolicy(policy, frames);
+    engine.runChunks(source);
+    return engine.getStatistics(0);
+}
+
+/**
+ * @brief Executa uma politica lendo o trace em streaming
+ * 
+ * A leitura do proximo bloco acontece em segundo plano enquanto o bloco
+ * atual e simulado.
+ */
+AlgorithmStatistics TraceReplay::replayStream(ReplayPolicy policy, int frames,
+                                              const std::string& path,
+                                              size_t chunkSize) {
+    if (!supportsStreaming(policy)) {
+        throw std::invalid_argument("Algoritmo " + getPolicyName(policy) + 
+                                    " precisa do trace completo (sem streaming)");
+    }
+    
+    TraceStream stream(path, chunkSize);
+    return replayChunks(policy, frames, stream);
+}
+
+/**
+ * @brief Executa uma politica sobre uma carga sintetica gerada bloco a bloco
+ * 
+ * A carga nunca e materializada: a memoria usada e a de um bloco.
+ */
+AlgorithmStatistics TraceReplay::replayWorkload(ReplayPolicy policy, int frames,
+                                                const WorkloadConfig& workload,
+                                                size_t chunkSize) {
+    WorkloadGenerator generator(workload, chunkSize);
+    return replayChunks(policy, frames, generator);
+}
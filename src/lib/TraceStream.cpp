@@ -0,0 +1,188 @@
+#include "../include/TraceStream.h"
+#include "../include/FrameStore.h"
+#include <stdexcept>
+#include <algorithm>
+
+/**
+ * @brief Remove do bloco os IDs negativos, mantendo a ordem dos demais
+ * @return Numero de IDs mantidos
+ */
+template <typename PageId>
+static size_t dropNegativePages(PageId* pages, size_t count) {
+    return std::remove_if(pages, pages + count, [](PageId page) { return page < 0; }) - pages;
+}
+
+/**
+ * @brief Abre o trace, valida o cabecalho e inicia a thread de leitura
+ * @param path Trace binario (formato PGTRACE)
+ * @param chunkSize Paginas por bloco
+ */
+TraceStream::TraceStream(const std::string& path, size_t chunkSize)
+    : chunkSize(chunkSize), referenceCount(0), remaining(0), pageIdWidth(sizeof(int)),
+      invalidReferences(0), consumerIndex(0), consumerHolding(false), finished(false), stopRequested(false) {
+    
+    if (chunkSize == 0) {
+        throw std::invalid_argument("Tamanho do bloco deve ser positivo");
+    }
+    
+    file.open(path.c_str(), std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Nao foi possivel abrir o trace: " + path);
+    }
+    
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+    
+    TraceFileHeader header;
+    if (fileSize < static_cast<std::streamoff>(sizeof(header)) ||
+        !file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("Trace binario invalido: " + path);
+    }
+    TraceFile::validateHeader(header, static_cast<size_t>(fileSize), path);
+    
+    referenceCount = header.referenceCount;
+    remaining = referenceCount;
+    pageIdWidth = header.pageIdWidth;
+    if (pageIdWidth == sizeof(int64_t)) {
+        wideBuffer.resize(chunkSize);
+    }
+    
+    for (int i = 0; i < 2; ++i) {
+        buffers[i].resize(chunkSize);
+        counts[i] = 0;
+        ready[i] = false;
+    }
+    
+    reader = std::thread(&TraceStream::readLoop, this);
+}
+
+/**
+ * @brief Interrompe a thread de leitura e fecha o arquivo
+ */
+TraceStream::~TraceStream() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    condition.notify_all();
+    
+    if (reader.joinable()) {
+        reader.join();
+    }
+}
+
+/**
+ * @brief Laco da thread de leitura: preenche os buffers alternadamente
+ */
+void TraceStream::readLoop() {
+    int index = 0;
+    
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&] { return stopRequested || !ready[index]; });
+            if (stopRequested) {
+                return;
+            }
+            if (remaining == 0) {
+                finished = true;
+                condition.notify_all();
+                return;
+            }
+        }
+        
+        // Leitura fora do lock: o consumidor segue no outro buffer
+        size_t count = static_cast<size_t>(std::min<uint64_t>(chunkSize, remaining));
+        size_t kept = count;
+        std::string failure;
+        if (pageIdWidth == sizeof(int64_t)) {
+            // IDs de 64 bits viram IDs densos ainda nesta thread
+            if (!file.read(reinterpret_cast<char*>(wideBuffer.data()), count * sizeof(int64_t))) {
+                failure = "Erro de leitura no trace";
+            } else {
+                try {
+                    kept = dropNegativePages(wideBuffer.data(), count);
+                    pageMap.internAll(wideBuffer.data(), kept, buffers[index].data());
+                } catch (const std::exception& e) {
+                    failure = e.what();
+                }
+            }
+        } else if (!file.read(reinterpret_cast<char*>(buffers[index].data()), count * sizeof(int))) {
+            failure = "Erro de leitura no trace";
+        } else {
+            // Os frames guardam 0..MAX_PAGE: negativos sao descartados e o
+            // ultimo int, reservado, exige o trace de 64 bits
+            int* pages = buffers[index].data();
+            bool inRange = std::all_of(pages, pages + count, [](int page) {
+                return page >= 0 && page <= PackedFrame::MAX_PAGE;
+            });
+            if (!inRange) {
+                if (std::find(pages, pages + count, PackedFrame::MAX_PAGE + 1) != pages + count) {
+                    failure = "Pagina 2147483647 fora da faixa dos frames (reconverta o trace com --convert)";
+                } else {
+                    kept = dropNegativePages(pages, count);
+                }
+            }
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failure.empty()) {
+                error = failure;
+                finished = true;
+                condition.notify_all();
+                return;
+            }
+            
+            remaining -= count;
+            invalidReferences += count - kept;
+            counts[index] = kept;
+            ready[index] = true;
+        }
+        condition.notify_all();
+        index ^= 1;
+    }
+}
+
+/**
+ * @brief Entrega o proximo bloco lido
+ * @param pages Recebe ponteiro para as paginas do bloco
+ * @param count Recebe o numero de paginas do bloco
+ * @return false quando o trace terminou
+ *
+ * O ponteiro continua valido ate a proxima chamada.
+ */
+bool TraceStream::nextChunk(const int*& pages, size_t& count) {
+    std::unique_lock<std::mutex> lock(mutex);
+    
+    if (consumerHolding) {
+        // Devolve o bloco anterior para a thread de leitura
+        ready[consumerIndex] = false;
+        consumerIndex ^= 1;
+        consumerHolding = false;
+        condition.notify_all();
+    }
+    
+    condition.wait(lock, [&] { return ready[consumerIndex] || finished; });
+    
+    if (!ready[consumerIndex]) {
+        if (!error.empty()) {
+            throw std::runtime_error(error);
+        }
+        return false;
+    }
+    
+    pages = buffers[consumerIndex].data();
+    count = counts[consumerIndex];
+    consumerHolding = true;
+    return true;
+}
+
+/**
+ * @brief Numero de IDs negativos descartados pela thread de leitura
+ */
+uint64_t TraceStream::getInvalidReferences() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return invalidReferences;
+}
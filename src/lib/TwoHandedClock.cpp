@@ -0,0 +1,337 @@
+#include "../include/TwoHandedClock.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+/**
+ * @brief Faixa do histograma: valores abaixo de 4 tem faixa propria;
+ *        acima, 4 faixas por potencia de 2 (os 2 bits apos o mais alto)
+ */
+int LatencyHistogram::bucketOf(uint64_t nanoseconds) {
+    if (nanoseconds < 4) {
+        return static_cast<int>(nanoseconds);
+    }
+    int exponent = 63 - __builtin_clzll(nanoseconds);
+    int mantissa = static_cast<int>((nanoseconds >> (exponent - 2)) & 3);
+    return (exponent - 1) * 4 + mantissa;
+}
+
+/**
+ * @brief Maior valor que cai na faixa
+ */
+uint64_t LatencyHistogram::upperBound(int bucket) {
+    if (bucket < 4) {
+        return static_cast<uint64_t>(bucket);
+    }
+    int exponent = bucket / 4 + 1;
+    uint64_t mantissa = static_cast<uint64_t>(bucket % 4);
+    return ((4 + mantissa + 1) << (exponent - 2)) - 1;
+}
+
+/**
+ * @brief Registra uma latencia
+ */
+void LatencyHistogram::record(uint64_t nanoseconds) {
+    buckets[bucketOf(nanoseconds)]++;
+    count++;
+    totalNanoseconds += nanoseconds;
+    maxNanoseconds = std::max(maxNanoseconds, nanoseconds);
+}
+
+/**
+ * @brief Zera o histograma
+ */
+void LatencyHistogram::reset() {
+    std::fill(buckets, buckets + BUCKETS, 0);
+    count = 0;
+    totalNanoseconds = 0;
+    maxNanoseconds = 0;
+}
+
+/**
+ * @brief Percentil aproximado
+ * @param fraction Fracao dos registros (0.5 = mediana, 0.99 = p99)
+ * @return Limite superior da faixa do percentil, sem passar do maximo
+ */
+uint64_t LatencyHistogram::getPercentile(double fraction) const {
+    if (count == 0) {
+        return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(fraction * count);
+    rank = std::max<uint64_t>(1, std::min(rank, count));
+    
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < BUCKETS; ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            return std::min(upperBound(bucket), maxNanoseconds);
+        }
+    }
+    return maxNanoseconds;
+}
+
+/**
+ * @brief Construtor do Clock de dois ponteiros
+ * @param frames Frames da memoria fisica
+ * @param pages Paginas possiveis (IDs 0..pageCount-1)
+ * @param options Spread dos ponteiros, marcas da reserva e modo do daemon
+ */
+TwoHandedClock::TwoHandedClock(int frames, int pages, const PageDaemonOptions& options)
+    : memorySize(frames), pageCount(pages), handSpread(options.handSpread),
+      lowWatermark(options.lowWatermark), highWatermark(options.highWatermark),
+      background(options.background), freeHead(0), freeTail(0), frontHand(0), stalls(0),
+      daemonActive(false), stopping(false) {
+    
+    if (frames <= 0) {
+        throw std::invalid_argument("Tamanho da memoria deve ser positivo");
+    }
+    if (pages <= 0) {
+        throw std::invalid_argument("Numero de paginas deve ser positivo");
+    }
+    
+    if (handSpread < 0) {
+        handSpread = frames / 2;
+    }
+    if (lowWatermark == 0) {
+        lowWatermark = std::max(1, frames / 64);
+    }
+    if (highWatermark == 0) {
+        highWatermark = std::min(frames, std::max(lowWatermark + 1, frames / 32));
+    }
+    if (handSpread >= frames) {
+        throw std::invalid_argument("Spread dos ponteiros deve ser menor que o numero de frames");
+    }
+    if (lowWatermark <= 0 || highWatermark < lowWatermark || highWatermark > frames) {
+        throw std::invalid_argument("Marcas da reserva invalidas (0 < baixa <= alta <= frames)");
+    }
+    
+    pageFrame.reset(new std::atomic<int>[pages]);
+    framePage.reset(new std::atomic<int>[frames]);
+    referenceBits.reset(new std::atomic<uint8_t>[frames]);
+    freeRing.reset(new int[frames]);
+    reset();
+}
+
+/**
+ * @brief Encerra o daemon, se ainda estiver rodando
+ */
+TwoHandedClock::~TwoHandedClock() {
+    stopDaemon();
+}
+
+/**
+ * @brief Volta ao estado inicial: todos os frames na reserva
+ */
+void TwoHandedClock::reset() {
+    for (int page = 0; page < pageCount; ++page) {
+        pageFrame[page].store(NOT_RESIDENT, std::memory_order_relaxed);
+    }
+    for (int frame = 0; frame < memorySize; ++frame) {
+        framePage[frame].store(FREE, std::memory_order_relaxed);
+        referenceBits[frame].store(0, std::memory_order_relaxed);
+        freeRing[frame] = frame;
+    }
+    freeHead.store(0, std::memory_order_relaxed);
+    freeTail.store(static_cast<uint64_t>(memorySize), std::memory_order_release);
+    frontHand = 0;
+    
+    stats.reset();
+    faultLatency.reset();
+    stalls = 0;
+    daemonStats = PageDaemonStatistics();
+}
+
+/**
+ * @brief Um passo dos dois ponteiros (so o daemon chama)
+ *
+ * O da frente zera o bit do seu frame; o de tras retira a pagina se o
+ * bit dela continuar zerado desde a passagem do da frente. Frames na
+ * reserva sao pulados. So o daemon libera frames e so a aplicacao os
+ * ocupa, entao a pagina lida em framePage nao muda ate ser retirada.
+ */
+void TwoHandedClock::sweepStep() {
+    int backHand = frontHand - handSpread;
+    if (backHand < 0) {
+        backHand += memorySize;
+    }
+    
+    if (framePage[frontHand].load(std::memory_order_acquire) >= 0 &&
+        referenceBits[frontHand].load(std::memory_order_relaxed)) {
+        referenceBits[frontHand].store(0, std::memory_order_relaxed);
+        daemonStats.bitsCleared++;
+    }
+    
+    int page = framePage[backHand].load(std::memory_order_acquire);
+    if (page >= 0 && !referenceBits[backHand].load(std::memory_order_relaxed)) {
+        framePage[backHand].store(FREE, std::memory_order_relaxed);
+        pageFrame[page].store(NOT_RESIDENT, std::memory_order_relaxed);
+        
+        uint64_t tail = freeTail.load(std::memory_order_relaxed);
+        freeRing[tail % memorySize] = backHand;
+        freeTail.store(tail + 1, std::memory_order_release);
+        daemonStats.framesReclaimed++;
+    }
+    
+    frontHand = frontHand + 1 == memorySize ? 0 : frontHand + 1;
+    daemonStats.framesScanned++;
+}
+
+/**
+ * @brief Varre ate a reserva chegar a marca alta
+ */
+void TwoHandedClock::refill() {
+    auto begin = std::chrono::steady_clock::now();
+    daemonStats.wakeups++;
+    
+    while (freeFrames() < highWatermark && !stopping.load(std::memory_order_relaxed)) {
+        sweepStep();
+    }
+    
+    auto end = std::chrono::steady_clock::now();
+    daemonStats.busySeconds += std::chrono::duration<double>(end - begin).count();
+}
+
+/**
+ * @brief Acorda o daemon se ele estiver dormindo
+ *
+ * A cerca garante que o daemon, ao se declarar inativo, ve a reserva ja
+ * reduzida (e nao dorme) ou que a aplicacao ve o daemon inativo (e o
+ * notifica): nenhum despertar se perde. Com o daemon acordado, nao ha
+ * lock no fault.
+ */
+void TwoHandedClock::wakeDaemon() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!daemonActive.load()) {
+        std::lock_guard<std::mutex> lock(daemonMutex);
+        daemonWake.notify_one();
+    }
+}
+
+/**
+ * @brief Laco da thread do daemon
+ */
+void TwoHandedClock::daemonLoop() {
+    std::unique_lock<std::mutex> lock(daemonMutex);
+    
+    for (;;) {
+        daemonActive.store(false);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        daemonWake.wait(lock, [this] {
+            return stopping.load() || freeFrames() < lowWatermark;
+        });
+        if (stopping.load()) {
+            break;
+        }
+        
+        daemonActive.store(true);
+        lock.unlock();
+        refill();
+        lock.lock();
+    }
+}
+
+/**
+ * @brief Inicia a thread do daemon
+ */
+void TwoHandedClock::startDaemon() {
+    stopping.store(false);
+    daemonActive.store(true);
+    daemon = std::thread(&TwoHandedClock::daemonLoop, this);
+}
+
+/**
+ * @brief Encerra a thread do daemon (interrompe uma varredura em curso)
+ */
+void TwoHandedClock::stopDaemon() {
+    if (!daemon.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(daemonMutex);
+        stopping.store(true);
+    }
+    daemonWake.notify_one();
+    daemon.join();
+    stopping.store(false);
+}
+
+/**
+ * @brief Referencia uma pagina a partir da thread da aplicacao
+ * @param pageNumber Pagina (0..pageCount-1)
+ * @return true se houve page fault, false se foi hit
+ *
+ * O hit nao tem lock nem escrita se o bit ja estiver ligado. O fault
+ * retira um frame da reserva; so a espera por frames (reserva vazia) ou
+ * a varredura no proprio fault (sem daemon) dependem do tamanho da
+ * memoria. A latencia de cada fault e registrada no histograma.
+ */
+bool TwoHandedClock::referencePage(int pageNumber) {
+    stats.totalReferences++;
+    
+    int frame = pageFrame[pageNumber].load(std::memory_order_relaxed);
+    if (frame >= 0) {
+        if (!referenceBits[frame].load(std::memory_order_relaxed)) {
+            referenceBits[frame].store(1, std::memory_order_relaxed);
+        }
+        stats.hits++;
+        return false;
+    }
+    
+    auto begin = std::chrono::steady_clock::now();
+    stats.pageFaults++;
+    
+    if (!daemon.joinable()) {
+        if (freeFrames() < lowWatermark) {
+            refill();
+        }
+    } else if (freeFrames() == 0) {
+        stalls++;
+        wakeDaemon();
+        while (freeFrames() == 0) {
+            std::this_thread::yield();
+        }
+    }
+    
+    uint64_t head = freeHead.load(std::memory_order_relaxed);
+    frame = freeRing[head % memorySize];
+    freeHead.store(head + 1, std::memory_order_release);
+    
+    // framePage por ultimo: o daemon so ve o frame ocupado com o resto pronto
+    referenceBits[frame].store(1, std::memory_order_relaxed);
+    pageFrame[pageNumber].store(frame, std::memory_order_relaxed);
+    framePage[frame].store(pageNumber, std::memory_order_release);
+    
+    if (daemon.joinable() && freeFrames() < lowWatermark) {
+        wakeDaemon();
+    }
+    
+    auto end = std::chrono::steady_clock::now();
+    faultLatency.record(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+    return true;
+}
+
+/**
+ * @brief Replay de um trace com o daemon em segundo plano (se background)
+ * @return Tempo de parede do replay
+ */
+double TwoHandedClock::replay(const int* pages, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (pages[i] < 0 || pages[i] >= pageCount) {
+            throw std::out_of_range("Pagina fora do intervalo do Clock de dois ponteiros");
+        }
+    }
+    
+    if (background) {
+        startDaemon();
+    }
+    
+    auto begin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        referencePage(pages[i]);
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    stopDaemon();
+    return std::chrono::duration<double>(end - begin).count();
+}
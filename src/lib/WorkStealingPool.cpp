@@ -0,0 +1,152 @@
+#include "../include/WorkStealingPool.h"
+
+/**
+ * @brief Numero padrao de threads (cores disponiveis, minimo 1)
+ */
+int WorkStealingPool::getDefaultThreadCount() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    return cores > 0 ? static_cast<int>(cores) : 1;
+}
+
+/**
+ * @brief Cria o pool e inicia os workers
+ */
+WorkStealingPool::WorkStealingPool(int threadCount)
+    : nextQueue(0), queuedTasks(0), pendingTasks(0), stopping(false) {
+    
+    if (threadCount <= 0) {
+        threadCount = getDefaultThreadCount();
+    }
+    
+    for (int i = 0; i < threadCount; ++i) {
+        queues.emplace_back(new WorkerQueue());
+    }
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, static_cast<size_t>(i));
+    }
+}
+
+/**
+ * @brief Aguarda as tarefas pendentes e encerra os workers
+ */
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Enfileira uma tarefa (distribuicao em rodizio entre os workers)
+ */
+void WorkStealingPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        pendingTasks++;
+    }
+    
+    // O contador sobe junto com o push, antes que alguem possa retirar a tarefa
+    size_t index = nextQueue.fetch_add(1) % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+        queuedTasks++;
+    }
+    
+    // Passa pelo lock de estado para nao perder a notificacao de quem vai dormir
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+    }
+    workAvailable.notify_one();
+}
+
+/**
+ * @brief Bloqueia ate que todas as tarefas submetidas terminem
+ * 
+ * Se alguma tarefa lancou excecao, a primeira e relancada aqui.
+ */
+void WorkStealingPool::wait() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return pendingTasks == 0; });
+    
+    if (firstError) {
+        std::exception_ptr error = firstError;
+        firstError = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Retira a tarefa mais antiga da propria fila
+ *
+ * Na ordem de submissao: o SweepEngine submete as tarefas mais caras
+ * primeiro, e elas nao podem ficar para o fim da varredura.
+ */
+bool WorkStealingPool::popLocal(size_t index, std::function<void()>& task) {
+    WorkerQueue& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return true;
+}
+
+/**
+ * @brief Rouba a tarefa mais antiga da fila de outro worker
+ */
+bool WorkStealingPool::steal(size_t thief, std::function<void()>& task) {
+    for (size_t offset = 1; offset < queues.size(); ++offset) {
+        WorkerQueue& victim = *queues[(thief + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Laco de um worker: executa tarefas locais, depois rouba, depois dorme
+ */
+void WorkStealingPool::workerLoop(size_t index) {
+    std::function<void()> task;
+    
+    while (true) {
+        if (popLocal(index, task) || steal(index, task)) {
+            queuedTasks--;
+            std::exception_ptr error;
+            try {
+                task();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            task = nullptr;
+            
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (error && !firstError) {
+                firstError = error;
+            }
+            if (--pendingTasks == 0) {
+                allDone.notify_all();
+            }
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(stateMutex);
+        workAvailable.wait(lock, [this] { return stopping || queuedTasks > 0; });
+        if (stopping && queuedTasks == 0) {
+            return;
+        }
+    }
+}
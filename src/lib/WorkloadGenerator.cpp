@@ -0,0 +1,352 @@
+#include "../include/WorkloadGenerator.h"
+#include <cmath>
+#include <cstdlib>
+#include <cerrno>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+
+/**
+ * @brief log1p(x) / x, estavel para x proximo de zero
+ */
+static double log1pOverX(double x) {
+    if (std::fabs(x) > 1e-8) {
+        return std::log1p(x) / x;
+    }
+    return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+}
+
+/**
+ * @brief expm1(x) / x, estavel para x proximo de zero
+ */
+static double expm1OverX(double x) {
+    if (std::fabs(x) > 1e-8) {
+        return std::expm1(x) / x;
+    }
+    return 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+}
+
+/**
+ * @brief Construtor
+ * @param config Parametros da carga
+ * @param blockSize Referencias por bloco entregue em nextChunk
+ */
+WorkloadGenerator::WorkloadGenerator(const WorkloadConfig& config, size_t blockSize)
+    : config(config), produced(0), phaseBase(0), buffer(blockSize),
+      zipfIntegralX1(0.0), zipfIntegralN(0.0), zipfThreshold(0.0) {
+    
+    if (blockSize == 0) {
+        throw std::invalid_argument("Tamanho do bloco deve ser positivo");
+    }
+    validate();
+    initializeZipf();
+    reset();
+}
+
+/**
+ * @brief Verifica a consistencia dos parametros
+ */
+void WorkloadGenerator::validate() const {
+    if (config.pageCount <= 0) {
+        throw std::invalid_argument("Carga: numero de paginas deve ser positivo");
+    }
+    if (config.workingSetSize <= 0) {
+        throw std::invalid_argument("Carga: working set deve ser positivo");
+    }
+    if (config.type == WorkloadType::PHASED && config.workingSetSize > config.pageCount) {
+        throw std::invalid_argument("Carga: working set maior que o numero de paginas");
+    }
+    if (config.phaseLength == 0) {
+        throw std::invalid_argument("Carga: tamanho da fase deve ser positivo");
+    }
+    if (!(config.locality >= 0.0 && config.locality <= 1.0)) {
+        throw std::invalid_argument("Carga: localidade deve estar entre 0 e 1");
+    }
+    if (!(config.zipfAlpha > 0.0)) {
+        throw std::invalid_argument("Carga: expoente Zipf deve ser positivo");
+    }
+}
+
+/**
+ * @brief Recomeca a sequencia a partir da semente
+ */
+void WorkloadGenerator::reset() {
+    rng.seed(config.seed);
+    produced = 0;
+    phaseBase = 0;
+}
+
+/**
+ * @brief Uniforme em [0, 1) com 53 bits (independente da biblioteca padrao)
+ * 
+ * std::mt19937_64 tem sequencia definida pelo padrao, mas as classes
+ * de distribuicao nao; por isso a conversao e feita aqui.
+ */
+double WorkloadGenerator::nextUniform() {
+    return (rng() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief Inteiro uniforme em [0, bound)
+ */
+int WorkloadGenerator::nextBelow(int bound) {
+    return static_cast<int>(nextUniform() * bound);
+}
+
+/**
+ * @brief h(x) = x^-alpha
+ */
+double WorkloadGenerator::zipfH(double x) const {
+    return std::exp(-config.zipfAlpha * std::log(x));
+}
+
+/**
+ * @brief Integral de h, H(x) = (x^(1-alpha) - 1) / (1 - alpha)
+ */
+double WorkloadGenerator::zipfIntegral(double x) const {
+    double logX = std::log(x);
+    return expm1OverX((1.0 - config.zipfAlpha) * logX) * logX;
+}
+
+/**
+ * @brief Inversa de H
+ */
+double WorkloadGenerator::zipfIntegralInverse(double x) const {
+    double t = x * (1.0 - config.zipfAlpha);
+    if (t < -1.0) {
+        t = -1.0;
+    }
+    return std::exp(log1pOverX(t) * x);
+}
+
+/**
+ * @brief Pre-calcula as constantes da amostragem Zipf
+ * 
+ * Rejeicao-inversao (Hormann e Derflinger): memoria O(1) e custo
+ * esperado constante por amostra, para qualquer numero de paginas.
+ */
+void WorkloadGenerator::initializeZipf() {
+    zipfIntegralX1 = zipfIntegral(1.5) - 1.0;
+    zipfIntegralN = zipfIntegral(config.pageCount + 0.5);
+    zipfThreshold = 2.0 - zipfIntegralInverse(zipfIntegral(2.5) - zipfH(2.0));
+}
+
+/**
+ * @brief Amostra uma pagina Zipf (0 = mais popular)
+ */
+int WorkloadGenerator::nextZipf() {
+    while (true) {
+        double u = zipfIntegralN + nextUniform() * (zipfIntegralX1 - zipfIntegralN);
+        double x = zipfIntegralInverse(u);
+        
+        long k = static_cast<long>(x + 0.5);
+        if (k < 1) {
+            k = 1;
+        } else if (k > config.pageCount) {
+            k = config.pageCount;
+        }
+        
+        if (k - x <= zipfThreshold || u >= zipfIntegral(k + 0.5) - zipfH(static_cast<double>(k))) {
+            return static_cast<int>(k - 1);
+        }
+    }
+}
+
+/**
+ * @brief Gera o proximo trecho da sequencia
+ * @param out Destino
+ * @param maxCount Capacidade do destino
+ * @return Referencias geradas (0 quando a carga terminou)
+ */
+size_t WorkloadGenerator::generate(int* out, size_t maxCount) {
+    uint64_t left = config.length - produced;
+    size_t count = left < maxCount ? static_cast<size_t>(left) : maxCount;
+    
+    switch (config.type) {
+        case WorkloadType::UNIFORM:
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = nextBelow(config.pageCount);
+            }
+            break;
+        case WorkloadType::ZIPF:
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = nextZipf();
+            }
+            break;
+        case WorkloadType::SCAN:
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = static_cast<int>((produced + i) % config.pageCount);
+            }
+            break;
+        case WorkloadType::LOOP:
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = static_cast<int>((produced + i) % config.workingSetSize);
+            }
+            break;
+        case WorkloadType::PHASED:
+            for (size_t i = 0; i < count; ++i) {
+                // Nova fase: o working set passa a comecar em uma pagina sorteada
+                if ((produced + i) % config.phaseLength == 0) {
+                    phaseBase = nextBelow(config.pageCount);
+                }
+                if (nextUniform() < config.locality) {
+                    int offset = nextBelow(config.workingSetSize);
+                    out[i] = static_cast<int>((static_cast<int64_t>(phaseBase) + offset) % config.pageCount);
+                } else {
+                    out[i] = nextBelow(config.pageCount);
+                }
+            }
+            break;
+    }
+    
+    produced += count;
+    return count;
+}
+
+/**
+ * @brief Entrega o proximo bloco gerado
+ * @return false quando a carga terminou
+ */
+bool WorkloadGenerator::nextChunk(const int*& pages, size_t& count) {
+    count = generate(buffer.data(), buffer.size());
+    pages = buffer.data();
+    return count > 0;
+}
+
+/**
+ * @brief Gera a carga inteira em um vetor
+ */
+std::vector<int> WorkloadGenerator::materialize(const WorkloadConfig& config) {
+    WorkloadGenerator generator(config);
+    std::vector<int> pages(static_cast<size_t>(config.length));
+    
+    size_t filled = 0;
+    while (filled < pages.size()) {
+        filled += generator.generate(pages.data() + filled, pages.size() - filled);
+    }
+    return pages;
+}
+
+/**
+ * @brief Converte um valor numerico da especificacao
+ */
+static double parseNumber(const std::string& key, const std::string& value) {
+    char* end = nullptr;
+    errno = 0;
+    double number = std::strtod(value.c_str(), &end);
+    
+    if (value.empty() || *end != '\0' || errno == ERANGE || !(number >= 0.0)) {
+        throw std::invalid_argument("Carga: valor invalido para " + key + ": " + value);
+    }
+    return number;
+}
+
+/**
+ * @brief Converte um valor inteiro da especificacao
+ * 
+ * Digitos sao lidos com strtoull, sem passar por double: sementes acima
+ * de 2^53 continuam distintas. Notacao cientifica (ex.: 1e9) ainda e
+ * aceita, exata ate 2^53.
+ */
+static uint64_t parseInteger(const std::string& key, const std::string& value) {
+    bool digits = !value.empty() && std::all_of(value.begin(), value.end(), [](char c) {
+        return c >= '0' && c <= '9';
+    });
+    
+    if (digits) {
+        errno = 0;
+        unsigned long long number = std::strtoull(value.c_str(), nullptr, 10);
+        if (errno == ERANGE) {
+            throw std::invalid_argument("Carga: valor invalido para " + key + ": " + value);
+        }
+        return static_cast<uint64_t>(number);
+    }
+    
+    double number = parseNumber(key, value);
+    if (number >= 18446744073709551616.0) {
+        throw std::invalid_argument("Carga: valor invalido para " + key + ": " + value);
+    }
+    return static_cast<uint64_t>(number);
+}
+
+/**
+ * @brief Le uma especificacao tipo[:chave=valor,...]
+ * 
+ * Exemplo: zipf:pages=100000,alpha=0.9,length=1e9,seed=7
+ */
+WorkloadConfig WorkloadGenerator::parseSpec(const std::string& spec) {
+    WorkloadConfig config;
+    size_t colon = spec.find(':');
+    
+    if (!parseType(spec.substr(0, colon), config.type)) {
+        throw std::invalid_argument("Carga desconhecida: " + spec.substr(0, colon));
+    }
+    
+    if (colon != std::string::npos) {
+        std::stringstream ss(spec.substr(colon + 1));
+        std::string item;
+        
+        while (std::getline(ss, item, ',')) {
+            size_t equals = item.find('=');
+            if (equals == std::string::npos) {
+                throw std::invalid_argument("Carga: esperado chave=valor em " + item);
+            }
+            std::string key = item.substr(0, equals);
+            std::string value = item.substr(equals + 1);
+            
+            if (key == "length") {
+                config.length = parseInteger(key, value);
+            } else if (key == "pages") {
+                config.pageCount = static_cast<int>(std::min<uint64_t>(parseInteger(key, value), 2147483647));
+            } else if (key == "ws") {
+                config.workingSetSize = static_cast<int>(std::min<uint64_t>(parseInteger(key, value), 2147483647));
+            } else if (key == "phase") {
+                config.phaseLength = parseInteger(key, value);
+            } else if (key == "locality") {
+                config.locality = parseNumber(key, value);
+            } else if (key == "alpha") {
+                config.zipfAlpha = parseNumber(key, value);
+            } else if (key == "seed") {
+                config.seed = parseInteger(key, value);
+            } else {
+                throw std::invalid_argument("Carga: chave desconhecida: " + key);
+            }
+        }
+    }
+    
+    return config;
+}
+
+/**
+ * @brief Converte nome em tipo de carga
+ */
+bool WorkloadGenerator::parseType(const std::string& name, WorkloadType& type) {
+    if (name == "uniform" || name == "random") {
+        type = WorkloadType::UNIFORM;
+    } else if (name == "zipf") {
+        type = WorkloadType::ZIPF;
+    } else if (name == "scan") {
+        type = WorkloadType::SCAN;
+    } else if (name == "loop") {
+        type = WorkloadType::LOOP;
+    } else if (name == "phased") {
+        type = WorkloadType::PHASED;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Nome do tipo de carga
+ */
+std::string WorkloadGenerator::getTypeName(WorkloadType type) {
+    switch (type) {
+        case WorkloadType::UNIFORM: return "uniform";
+        case WorkloadType::ZIPF: return "zipf";
+        case WorkloadType::SCAN: return "scan";
+        case WorkloadType::LOOP: return "loop";
+        case WorkloadType::PHASED: return "phased";
+        default: return "unknown";
+    }
+}